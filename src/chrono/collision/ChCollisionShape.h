@@ -53,7 +53,7 @@ class ChApi ChCollisionShape {
     virtual ~ChCollisionShape() {}
 
     Type GetType() const { return m_type; }
-    std::shared_ptr<ChMaterialSurface> GetMaterial() const { return m_material; }
+    const std::shared_ptr<ChMaterialSurface>& GetMaterial() const { return m_material; }
     ChContactMethod GetContactMethod() const { return m_material->GetContactMethod(); }
 
   protected:
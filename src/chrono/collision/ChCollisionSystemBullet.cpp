@@ -19,6 +19,7 @@
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChProximityContainer.h"
+#include "chrono/utils/ChTraceProfiler.h"
 #include "chrono/collision/bullet/LinearMath/btPoolAllocator.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btSphereShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btCylinderShape.h"
@@ -1283,6 +1284,7 @@ void ChCollisionSystemBullet::Remove(ChCollisionModel* model) {
 }
 
 void ChCollisionSystemBullet::Run() {
+    CH_PROFILE_ZONE("ChCollisionSystemBullet::Run");
     if (bt_collision_world) {
         bt_collision_world->performDiscreteCollisionDetection();
     }
@@ -15,6 +15,8 @@
 #ifndef CHFRAME_H
 #define CHFRAME_H
 
+#include <vector>
+
 #include "chrono/core/ChCoordsys.h"
 #include "chrono/core/ChMatrix.h"
 #include "chrono/core/ChMatrix33.h"
@@ -354,6 +356,46 @@ class ChFrame {
         return Amatrix * mdirection;
     }
 
+    // BATCHED TRANSFORMATIONS
+
+    /// Transform an array of points from 'this' local coordinate system to the parent coordinate system.
+    /// The output array is resized as needed and may be the same as the input array.
+    /// Uses AVX instructions when available (see ChTransform).
+    void TransformPointsLocalToParent(const std::vector<ChVector<Real>>& local,
+                                      std::vector<ChVector<Real>>& parent) const {
+        parent.resize(local.size());
+        ChTransform<Real>::TransformLocalToParent(local.data(), parent.data(), local.size(), coord.pos, Amatrix);
+    }
+
+    /// Transform an array of points from the parent coordinate system to 'this' local coordinate system.
+    /// The output array is resized as needed and may be the same as the input array.
+    /// Uses AVX instructions when available (see ChTransform).
+    void TransformPointsParentToLocal(const std::vector<ChVector<Real>>& parent,
+                                      std::vector<ChVector<Real>>& local) const {
+        local.resize(parent.size());
+        ChTransform<Real>::TransformParentToLocal(parent.data(), local.data(), parent.size(), coord.pos, Amatrix);
+    }
+
+    /// Transform an array of directions from 'this' local coordinate system to the parent coordinate system.
+    /// The output array is resized as needed and may be the same as the input array.
+    void TransformDirectionsLocalToParent(const std::vector<ChVector<Real>>& local,
+                                          std::vector<ChVector<Real>>& parent) const {
+        parent.resize(local.size());
+        ChTransform<Real>::TransformLocalToParent(local.data(), parent.data(), local.size(), ChVector<Real>(0, 0, 0),
+                                                  Amatrix);
+    }
+
+    /// Transform an array of frames from 'this' local coordinate system to the parent coordinate system,
+    /// i.e. compose this frame with each of the given frames. The output array is resized as needed and
+    /// may be the same as the input array.
+    void TransformFramesLocalToParent(const std::vector<ChFrame<Real>>& local,
+                                      std::vector<ChFrame<Real>>& parent) const {
+        parent.resize(local.size());
+        for (size_t i = 0; i < local.size(); i++)
+            parent[i].SetCoord(ChTransform<Real>::TransformLocalToParent(local[i].coord.pos, coord.pos, Amatrix),
+                               coord.rot % local[i].coord.rot);
+    }
+
     // OTHER FUNCTIONS
 
     /// Returns true if coordsys is identical to other coordsys
@@ -23,6 +23,10 @@
 #include "chrono/core/ChVector.h"
 #include "chrono/core/ChMathematics.h"
 
+#if defined(CHRONO_HAS_AVX) && defined(__AVX__)
+#include <immintrin.h>
+#endif
+
 namespace chrono {
 
 /// Definitions of various angle sets for conversions.
@@ -962,6 +966,36 @@ inline void ChQuaternion<Real>::Cross(const ChQuaternion<Real>& qa, const ChQuat
     data[3] = z;
 }
 
+#if defined(CHRONO_HAS_AVX) && defined(__AVX__)
+
+// AVX version of the quaternion product for double precision, evaluated as
+//   q = a0*[b0 b1 b2 b3] + a1*[-b1 b0 -b3 b2] + a2*[-b2 b3 b0 -b1] + a3*[-b3 -b2 b1 b0]
+// Both operands are fully loaded before the result is stored, so qa or qb may alias this quaternion.
+template <>
+inline void ChQuaternion<double>::Cross(const ChQuaternion<double>& qa, const ChQuaternion<double>& qb) {
+    __m256d b = _mm256_loadu_pd(qb.data);                // b0 b1 b2 b3
+    __m256d b1032 = _mm256_permute_pd(b, 0x5);           // b1 b0 b3 b2
+    __m256d b2301 = _mm256_permute2f128_pd(b, b, 0x01);  // b2 b3 b0 b1
+    __m256d b3210 = _mm256_permute_pd(b2301, 0x5);       // b3 b2 b1 b0
+    b1032 = _mm256_xor_pd(b1032, _mm256_setr_pd(-0.0, 0.0, -0.0, 0.0));
+    b2301 = _mm256_xor_pd(b2301, _mm256_setr_pd(-0.0, 0.0, 0.0, -0.0));
+    b3210 = _mm256_xor_pd(b3210, _mm256_setr_pd(-0.0, -0.0, 0.0, 0.0));
+
+    __m256d q = _mm256_mul_pd(_mm256_broadcast_sd(qa.data), b);
+#if defined(__FMA__)
+    q = _mm256_fmadd_pd(_mm256_broadcast_sd(qa.data + 1), b1032, q);
+    q = _mm256_fmadd_pd(_mm256_broadcast_sd(qa.data + 2), b2301, q);
+    q = _mm256_fmadd_pd(_mm256_broadcast_sd(qa.data + 3), b3210, q);
+#else
+    q = _mm256_add_pd(q, _mm256_mul_pd(_mm256_broadcast_sd(qa.data + 1), b1032));
+    q = _mm256_add_pd(q, _mm256_mul_pd(_mm256_broadcast_sd(qa.data + 2), b2301));
+    q = _mm256_add_pd(q, _mm256_mul_pd(_mm256_broadcast_sd(qa.data + 3), b3210));
+#endif
+    _mm256_storeu_pd(data, q);
+}
+
+#endif
+
 template <class Real>
 inline Real ChQuaternion<Real>::Dot(const ChQuaternion<Real>& B) const {
     return (data[0] * B.data[0]) + (data[1] * B.data[1]) + (data[2] * B.data[2]) + (data[3] * B.data[3]);
@@ -15,10 +15,16 @@
 #ifndef CHTRANSFORM_H
 #define CHTRANSFORM_H
 
+#include <cstddef>
+
 #include "chrono/core/ChVector.h"
 #include "chrono/core/ChQuaternion.h"
 #include "chrono/core/ChMatrix33.h"
 
+#if defined(CHRONO_HAS_AVX) && defined(__AVX__)
+#include <immintrin.h>
+#endif
+
 namespace chrono {
 
 /// ChTransform: a class for fast coordinate transformations
@@ -152,8 +158,125 @@ class ChTransform {
                               origin.z() + ((e1e3 - e0e2) * 2.) * local.x() + ((e2e3 + e0e1) * 2.) * local.y() +
                                   ((e0e0 + e3e3) * 2. - 1.) * local.z());
     }
+
+    // TRANSFORMATIONS OF ARRAYS OF POINTS, USING POSITION AND ROTATION MATRIX [A]
+
+    /// Transform an array of n points from a local coordinate system to the parent coordinate system,
+    /// as parent[i] = origin + [A]*local[i]. The output array may coincide with the input array.
+    /// With AVX support, points are processed four at a time.
+    static void TransformLocalToParent(
+        const ChVector<Real>* local,       ///< points to transform, given in local coordinates
+        ChVector<Real>* parent,            ///< transformed points, in parent coordinates
+        size_t n,                          ///< number of points
+        const ChVector<Real>& origin,      ///< origin of frame respect to parent, in parent coords
+        const ChMatrix33<Real>& alignment  ///< rotation of frame respect to parent, in parent coords
+        ) {
+        TransformPoints(local, parent, n, alignment, ChVector<Real>(0, 0, 0), origin);
+    }
+
+    /// Transform an array of n points from the parent coordinate system to a local coordinate system,
+    /// as local[i] = [A]'*(parent[i]-origin). The output array may coincide with the input array.
+    /// With AVX support, points are processed four at a time.
+    static void TransformParentToLocal(
+        const ChVector<Real>* parent,      ///< points to transform, given in parent coordinates
+        ChVector<Real>* local,             ///< transformed points, in local coordinates
+        size_t n,                          ///< number of points
+        const ChVector<Real>& origin,      ///< origin of frame respect to parent, in parent coords
+        const ChMatrix33<Real>& alignment  ///< rotation of frame respect to parent, in parent coords
+        ) {
+        ChMatrix33<Real> alignment_T = alignment.transpose();
+        TransformPoints(parent, local, n, alignment_T, origin, ChVector<Real>(0, 0, 0));
+    }
+
+  private:
+    /// Array kernel: out[i] = post + [M]*(in[i]-pre).
+    static void TransformPoints(const ChVector<Real>* in,
+                                ChVector<Real>* out,
+                                size_t n,
+                                const ChMatrix33<Real>& M,
+                                const ChVector<Real>& pre,
+                                const ChVector<Real>& post) {
+        for (size_t i = 0; i < n; i++) {
+            Real x = in[i].x() - pre.x();
+            Real y = in[i].y() - pre.y();
+            Real z = in[i].z() - pre.z();
+            out[i] = ChVector<Real>(M(0, 0) * x + M(0, 1) * y + M(0, 2) * z + post.x(),
+                                    M(1, 0) * x + M(1, 1) * y + M(1, 2) * z + post.y(),
+                                    M(2, 0) * x + M(2, 1) * y + M(2, 2) * z + post.z());
+        }
+    }
 };
 
+#if defined(CHRONO_HAS_AVX) && defined(__AVX__)
+
+// AVX version of the array kernel for double precision. Blocks of four consecutive points (12 doubles) are
+// loaded with three packed loads, transposed to x, y, z registers, transformed, and transposed back.
+template <>
+inline void ChTransform<double>::TransformPoints(const ChVector<double>* in,
+                                                 ChVector<double>* out,
+                                                 size_t n,
+                                                 const ChMatrix33<double>& M,
+                                                 const ChVector<double>& pre,
+                                                 const ChVector<double>& post) {
+    static_assert(sizeof(ChVector<double>) == 3 * sizeof(double), "ChVector<double> must be tightly packed");
+
+    const double* src = reinterpret_cast<const double*>(in);
+    double* dst = reinterpret_cast<double*>(out);
+
+    __m256d m00 = _mm256_set1_pd(M(0, 0)), m01 = _mm256_set1_pd(M(0, 1)), m02 = _mm256_set1_pd(M(0, 2));
+    __m256d m10 = _mm256_set1_pd(M(1, 0)), m11 = _mm256_set1_pd(M(1, 1)), m12 = _mm256_set1_pd(M(1, 2));
+    __m256d m20 = _mm256_set1_pd(M(2, 0)), m21 = _mm256_set1_pd(M(2, 1)), m22 = _mm256_set1_pd(M(2, 2));
+    __m256d ax = _mm256_set1_pd(pre.x()), ay = _mm256_set1_pd(pre.y()), az = _mm256_set1_pd(pre.z());
+    __m256d bx = _mm256_set1_pd(post.x()), by = _mm256_set1_pd(post.y()), bz = _mm256_set1_pd(post.z());
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4, src += 12, dst += 12) {
+        // [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3] -> [x0 x1 x2 x3] [y0 y1 y2 y3] [z0 z1 z2 z3]
+        __m256d l0 = _mm256_loadu_pd(src);
+        __m256d l1 = _mm256_loadu_pd(src + 4);
+        __m256d l2 = _mm256_loadu_pd(src + 8);
+        __m256d t0 = _mm256_blend_pd(l0, l1, 0xC);          // x0 y0 x2 y2
+        __m256d t1 = _mm256_permute2f128_pd(l0, l2, 0x21);  // z0 x1 z2 x3
+        __m256d t2 = _mm256_blend_pd(l1, l2, 0xC);          // y1 z1 y3 z3
+        __m256d x = _mm256_sub_pd(_mm256_shuffle_pd(t0, t1, 0xA), ax);
+        __m256d y = _mm256_sub_pd(_mm256_shuffle_pd(t0, t2, 0x5), ay);
+        __m256d z = _mm256_sub_pd(_mm256_shuffle_pd(t1, t2, 0xA), az);
+
+#if defined(__FMA__)
+        __m256d rx = _mm256_fmadd_pd(m00, x, _mm256_fmadd_pd(m01, y, _mm256_fmadd_pd(m02, z, bx)));
+        __m256d ry = _mm256_fmadd_pd(m10, x, _mm256_fmadd_pd(m11, y, _mm256_fmadd_pd(m12, z, by)));
+        __m256d rz = _mm256_fmadd_pd(m20, x, _mm256_fmadd_pd(m21, y, _mm256_fmadd_pd(m22, z, bz)));
+#else
+        __m256d rx = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m00, x), _mm256_mul_pd(m01, y)),
+                                   _mm256_add_pd(_mm256_mul_pd(m02, z), bx));
+        __m256d ry = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m10, x), _mm256_mul_pd(m11, y)),
+                                   _mm256_add_pd(_mm256_mul_pd(m12, z), by));
+        __m256d rz = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(m20, x), _mm256_mul_pd(m21, y)),
+                                   _mm256_add_pd(_mm256_mul_pd(m22, z), bz));
+#endif
+
+        // Transpose back to [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3]
+        t0 = _mm256_shuffle_pd(rx, ry, 0x0);  // x0 y0 x2 y2
+        t1 = _mm256_shuffle_pd(rz, rx, 0xA);  // z0 x1 z2 x3
+        t2 = _mm256_shuffle_pd(ry, rz, 0xF);  // y1 z1 y3 z3
+        _mm256_storeu_pd(dst, _mm256_permute2f128_pd(t0, t1, 0x20));
+        _mm256_storeu_pd(dst + 4, _mm256_blend_pd(t2, t0, 0xC));
+        _mm256_storeu_pd(dst + 8, _mm256_permute2f128_pd(t1, t2, 0x31));
+    }
+
+    // Remaining points
+    for (; i < n; i++) {
+        double x = in[i].x() - pre.x();
+        double y = in[i].y() - pre.y();
+        double z = in[i].z() - pre.z();
+        out[i] = ChVector<double>(M(0, 0) * x + M(0, 1) * y + M(0, 2) * z + post.x(),
+                                  M(1, 0) * x + M(1, 1) * y + M(1, 2) * z + post.y(),
+                                  M(2, 0) * x + M(2, 1) * y + M(2, 2) * z + post.z());
+    }
+}
+
+#endif
+
 }  // end namespace chrono
 
 #endif
@@ -69,6 +69,10 @@ class ChApi ChElementBase {
     /// Compute element's nodal masses.
     virtual void ComputeNodalMass() {}
 
+    /// Estimate the critical step size for explicit time integration of this element in its current
+    /// configuration (Courant condition). Returns 0 if no estimate is available for this element type.
+    virtual double ComputeStableStepSize() { return 0; }
+
     /// Sets H as the stiffness matrix K, scaled  by Kfactor. Optionally, also
     /// superimposes global damping matrix R, scaled by Rfactor, and mass matrix M,
     /// scaled by Mfactor. Matrices are expressed in global reference.
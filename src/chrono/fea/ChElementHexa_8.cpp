@@ -12,6 +12,9 @@
 // Authors: Andrea Favali, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <limits>
+
 #include "chrono/fea/ChElementHexa_8.h"
 
 namespace chrono {
@@ -354,6 +357,17 @@ void ChElementHexa_8::ComputeInternalForces(ChVectorDynamic<>& Fi) {
     ChMatrixCorotation::ComputeCK(FiK_local, this->A, 8, Fi);
 }
 
+double ChElementHexa_8::ComputeStableStepSize() {
+    static const int edges[12][2] = {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {4, 5}, {5, 6},
+                                     {6, 7}, {7, 4}, {0, 4}, {1, 5}, {2, 6}, {3, 7}};
+    double length = std::numeric_limits<double>::max();
+    for (int i = 0; i < 12; i++)
+        length = std::min(length, (nodes[edges[i][1]]->GetPos() - nodes[edges[i][0]]->GetPos()).Length());
+
+    double speed = std::sqrt((Material->Get_l() + 2 * Material->Get_G()) / Material->Get_density());
+    return length / speed;
+}
+
 void ChElementHexa_8::LoadableGetStateBlock_x(int block_offset, ChState& mD) {
     mD.segment(block_offset + 0, 3) = nodes[0]->GetPos().eigen();
     mD.segment(block_offset + 3, 3) = nodes[1]->GetPos().eigen();
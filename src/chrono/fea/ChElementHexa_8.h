@@ -114,6 +114,10 @@ class ChApi ChElementHexa_8 : public ChElementHexahedron, public ChLoadableUVW {
     /// values in the Fi vector.
     virtual void ComputeInternalForces(ChVectorDynamic<>& Fi) override;
 
+    /// Estimate the critical step size for explicit integration, as the shortest edge of the
+    /// hexahedron divided by the speed of dilatational waves in the material.
+    virtual double ComputeStableStepSize() override;
+
     //
     // Custom properties functions
     //
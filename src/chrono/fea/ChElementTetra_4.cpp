@@ -12,6 +12,8 @@
 // Authors: Andrea Favali, Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/fea/ChElementTetra_4.h"
 
 namespace chrono {
@@ -289,6 +291,24 @@ void ChElementTetra_4::ComputeNodalMass() {
     nodes[3]->m_TotalMass += this->GetVolume() * this->Material->Get_density() / 4.0;
 }
 
+double ChElementTetra_4::ComputeStableStepSize() {
+    ChVector<> p0 = nodes[0]->GetPos();
+    ChVector<> e1 = nodes[1]->GetPos() - p0;
+    ChVector<> e2 = nodes[2]->GetPos() - p0;
+    ChVector<> e3 = nodes[3]->GetPos() - p0;
+    ChVector<> e4 = nodes[2]->GetPos() - nodes[1]->GetPos();
+    ChVector<> e5 = nodes[3]->GetPos() - nodes[1]->GetPos();
+
+    // Minimum height = 3 * volume / largest face area (areas and volume are scaled by 2 and 6, respectively)
+    double vol6 = std::abs(Vdot(e1, Vcross(e2, e3)));
+    double area2 = std::max(std::max(Vcross(e1, e2).Length(), Vcross(e1, e3).Length()),
+                            std::max(Vcross(e2, e3).Length(), Vcross(e4, e5).Length()));
+    double height = vol6 / area2;
+
+    double speed = std::sqrt((Material->Get_l() + 2 * Material->Get_G()) / Material->Get_density());
+    return height / speed;
+}
+
 void ChElementTetra_4::LoadableGetStateBlock_x(int block_offset, ChState& mD) {
     mD.segment(block_offset + 0, 3) = nodes[0]->GetPos().eigen();
     mD.segment(block_offset + 3, 3) = nodes[1]->GetPos().eigen();
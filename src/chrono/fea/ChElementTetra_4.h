@@ -114,6 +114,10 @@ class ChApi ChElementTetra_4 : public ChElementTetrahedron, public ChLoadableUVW
     /// This function computes and adds corresponding masses to ElementBase member m_TotalMass
     void ComputeNodalMass() override;
 
+    /// Estimate the critical step size for explicit integration, as the minimum height of the
+    /// tetrahedron divided by the speed of dilatational waves in the material.
+    virtual double ComputeStableStepSize() override;
+
     //
     // Functions for interfacing to the solver
     //            (***not needed, thank to bookkeeping in parent class ChElementGeneric)
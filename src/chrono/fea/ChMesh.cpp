@@ -28,6 +28,7 @@
 #include "chrono/fea/ChMesh.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
 #include "chrono/fea/ChNodeFEAxyzrot.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 namespace fea {
@@ -157,6 +158,7 @@ void ChMesh::Setup() {
 // Updates all time-dependant variables, if any...
 // Ex: maybe the elasticity can increase in time, etc.
 void ChMesh::Update(double m_time, bool update_assets) {
+    CH_PROFILE_ZONE("ChMesh::Update");
     // Parent class update
     ChIndexedNodes::Update(m_time, update_assets);
 
@@ -271,6 +273,7 @@ void ChMesh::IntLoadResidual_F(const unsigned int off,
                                ChVectorDynamic<>& R,   
                                const double c          
                                ) {
+    CH_PROFILE_ZONE("ChMesh::IntLoadResidual_F");
     // nodes applied forces
     unsigned int local_off_v = 0;
     for (unsigned int j = 0; j < vnodes.size(); j++) {
@@ -320,6 +323,16 @@ void ChMesh::IntLoadResidual_F(const unsigned int off,
 
 }
 
+double ChMesh::ComputeStableStepSize() {
+    double step = 0;
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        double ele_step = velements[ie]->ComputeStableStepSize();
+        if (ele_step > 0 && (step == 0 || ele_step < step))
+            step = ele_step;
+    }
+    return step;
+}
+
 void ChMesh::ComputeMassProperties(double& mass,           // ChMesh object mass
                                    ChVector<>& com,        // ChMesh center of gravity
                                    ChMatrix33<>& inertia)  // ChMesh inertia tensor
@@ -397,6 +410,7 @@ void ChMesh::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
 }
 
 void ChMesh::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
+    CH_PROFILE_ZONE("ChMesh::KRMmatricesLoad");
     timer_KRMload.start();
 #pragma omp parallel for
     for (int ie = 0; ie < velements.size(); ie++)
@@ -173,6 +173,11 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Tell if this mesh will add automatically a gravity load to all contained elements.
     bool GetAutomaticGravity() { return automatic_gravity_load; }
 
+    /// Estimate the critical step size for explicit time integration of this mesh, as the minimum of the
+    /// element estimates (see ChElementBase::ComputeStableStepSize). Elements that do not provide an estimate
+    /// are ignored. Returns 0 if no element provides an estimate.
+    double ComputeStableStepSize();
+
     /// Get ChMesh mass properties
     void ComputeMassProperties(double& mass,          ///< ChMesh object mass
                                ChVector<>& com,       ///< ChMesh center of gravity
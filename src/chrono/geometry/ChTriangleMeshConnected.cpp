@@ -44,6 +44,7 @@
 #include <map>
 #include <unordered_map>
 
+#include "chrono/core/ChTransform.h"
 #include "chrono/geometry/ChTriangleMeshConnected.h"
 
 namespace chrono {
@@ -1075,12 +1076,9 @@ ChTriangleMeshConnected ChTriangleMeshConnected::Merge(std::vector<ChTriangleMes
 }
 
 void ChTriangleMeshConnected::Transform(const ChVector<> displ, const ChMatrix33<> rotscale) {
-    for (int i = 0; i < m_vertices.size(); ++i) {
-        m_vertices[i] = rotscale * m_vertices[i];
-        m_vertices[i] += displ;
-    }
+    ChTransform<>::TransformLocalToParent(m_vertices.data(), m_vertices.data(), m_vertices.size(), displ, rotscale);
+    ChTransform<>::TransformLocalToParent(m_normals.data(), m_normals.data(), m_normals.size(), VNULL, rotscale);
     for (int i = 0; i < m_normals.size(); ++i) {
-        m_normals[i] = rotscale * m_normals[i];
         m_normals[i].Normalize();
     }
 }
@@ -100,6 +100,16 @@ class ChApi ChFunction {
     /// is known, it may be better to implement a custom method).
     virtual double Get_y_dxdx(double x) const { return ((Get_y_dx(x + BDF_STEP_LOW) - Get_y_dx(x)) / BDF_STEP_LOW); };
 
+    /// Return the value and the first two derivatives of the function, at position x.
+    /// This base method calls Get_y(), Get_y_dx() and Get_y_dxdx(). Composite functions (operations,
+    /// sequences, etc.) override it to evaluate each of their components only once, combining
+    /// the component derivatives with analytic chain rules.
+    virtual void Get_y_all(double x, double& y, double& y_dx, double& y_dxdx) const {
+        y = Get_y(x);
+        y_dx = Get_y_dx(x);
+        y_dxdx = Get_y_dxdx(x);
+    }
+
     /// Return the weight of the function (useful for
     /// applications where you need to mix different weighted ChFunctions)
     virtual double Get_weight(double x) const { return 1.0; };
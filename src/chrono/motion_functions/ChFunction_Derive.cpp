@@ -29,6 +29,10 @@ double ChFunction_Derive::Get_y(double x) const {
     return fa->Get_y_dx(x);
 }
 
+double ChFunction_Derive::Get_y_dx(double x) const {
+    return fa->Get_y_dxdx(x);
+}
+
 void ChFunction_Derive::Estimate_x_range(double& xmin, double& xmax) const {
     fa->Estimate_x_range(xmin, xmax);
 }
@@ -43,6 +43,7 @@ class ChApi ChFunction_Derive : public ChFunction {
     virtual FunctionType Get_Type() const override { return FUNCT_DERIVE; }
 
     virtual double Get_y(double x) const override;
+    virtual double Get_y_dx(double x) const override;
 
     void Set_order(int m_order) { order = m_order; }
     int Get_order() { return order; }
@@ -75,6 +75,18 @@ double ChFunction_Integrate::Get_y(double x) const {
     return (weightA * (array_x(i_a)) + weightB * (array_x(i_b)));
 }
 
+double ChFunction_Integrate::Get_y_dx(double x) const {
+    if ((x < x_start) || (x > x_end))
+        return 0.0;
+    return fa->Get_y(x);
+}
+
+double ChFunction_Integrate::Get_y_dxdx(double x) const {
+    if ((x < x_start) || (x > x_end))
+        return 0.0;
+    return fa->Get_y_dx(x);
+}
+
 void ChFunction_Integrate::Estimate_x_range(double& xmin, double& xmax) const {
     xmin = x_start;
     xmax = x_end;
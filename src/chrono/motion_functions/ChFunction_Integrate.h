@@ -46,6 +46,8 @@ class ChApi ChFunction_Integrate : public ChFunction {
     virtual FunctionType Get_Type() const override { return FUNCT_INTEGRATE; }
 
     virtual double Get_y(double x) const override;
+    virtual double Get_y_dx(double x) const override;
+    virtual double Get_y_dxdx(double x) const override;
 
     void ComputeIntegral();
 
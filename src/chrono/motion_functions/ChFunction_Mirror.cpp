@@ -34,6 +34,27 @@ double ChFunction_Mirror::Get_y(double x) const {
     return fa->Get_y(2 * this->mirror_axis - x);
 }
 
+double ChFunction_Mirror::Get_y_dx(double x) const {
+    if (x <= this->mirror_axis)
+        return fa->Get_y_dx(x);
+    return -fa->Get_y_dx(2 * this->mirror_axis - x);
+}
+
+double ChFunction_Mirror::Get_y_dxdx(double x) const {
+    if (x <= this->mirror_axis)
+        return fa->Get_y_dxdx(x);
+    return fa->Get_y_dxdx(2 * this->mirror_axis - x);
+}
+
+void ChFunction_Mirror::Get_y_all(double x, double& y, double& y_dx, double& y_dxdx) const {
+    if (x <= this->mirror_axis) {
+        fa->Get_y_all(x, y, y_dx, y_dxdx);
+        return;
+    }
+    fa->Get_y_all(2 * this->mirror_axis - x, y, y_dx, y_dxdx);
+    y_dx = -y_dx;
+}
+
 void ChFunction_Mirror::Estimate_x_range(double& xmin, double& xmax) const {
     fa->Estimate_x_range(xmin, xmax);
 }
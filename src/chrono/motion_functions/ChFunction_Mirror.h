@@ -41,6 +41,9 @@ class ChApi ChFunction_Mirror : public ChFunction {
     virtual FunctionType Get_Type() const override { return FUNCT_MIRROR; }
 
     virtual double Get_y(double x) const override;
+    virtual double Get_y_dx(double x) const override;
+    virtual double Get_y_dxdx(double x) const override;
+    virtual void Get_y_all(double x, double& y, double& y_dx, double& y_dxdx) const override;
 
     void Set_mirror_axis(double m_axis) { mirror_axis = m_axis; }
     double Get_mirror_axis() { return mirror_axis; }
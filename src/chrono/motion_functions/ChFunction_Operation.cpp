@@ -71,21 +71,122 @@ double ChFunction_Operation::Get_y(double x) const {
     }
     return res;
 }
-/*
-double ChFunction_Operation::Get_y_dx   (double x)
-{
-    double res = 0;
-    res = ChFunction::Get_y_dx(x); // default: numerical differentiation
-    return res;
+
+// Value and derivatives of f at x, up to the given order.
+static void EvaluateOperand(const ChFunction& f, double x, int order, double& y, double& y_dx, double& y_dxdx) {
+    y_dx = 0;
+    y_dxdx = 0;
+    if (order == 2) {
+        f.Get_y_all(x, y, y_dx, y_dxdx);
+        return;
+    }
+    y = f.Get_y(x);
+    if (order == 1)
+        y_dx = f.Get_y_dx(x);
 }
 
-double ChFunction_Operation::Get_y_dxdx (double x)
-{
-    double res = 0;
-    res = ChFunction::Get_y_dxdx(x); // default: numerical differentiation
-    return res;
+void ChFunction_Operation::Evaluate(double x, int order, double& y, double& y_dx, double& y_dxdx) const {
+    double a, a1, a2;
+    double b, b1, b2;
+
+    // Composition: y = fa(fb(x)), the only operation that evaluates fa elsewhere than at x
+    if (op_type == ChOP_FUNCT) {
+        EvaluateOperand(*fb, x, order, b, b1, b2);
+        EvaluateOperand(*fa, b, order, a, a1, a2);
+        y = a;
+        y_dx = a1 * b1;
+        y_dxdx = a2 * b1 * b1 + a1 * b2;
+        return;
+    }
+
+    EvaluateOperand(*fa, x, order, a, a1, a2);
+    if (op_type == ChOP_FABS) {
+        double s = (a < 0) ? -1 : 1;
+        y = s * a;
+        y_dx = s * a1;
+        y_dxdx = s * a2;
+        return;
+    }
+
+    EvaluateOperand(*fb, x, order, b, b1, b2);
+    switch (op_type) {
+        case ChOP_ADD:
+            y = a + b;
+            y_dx = a1 + b1;
+            y_dxdx = a2 + b2;
+            break;
+        case ChOP_SUB:
+            y = a - b;
+            y_dx = a1 - b1;
+            y_dxdx = a2 - b2;
+            break;
+        case ChOP_MUL:
+            y = a * b;
+            y_dx = a1 * b + a * b1;
+            y_dxdx = a2 * b + 2 * a1 * b1 + a * b2;
+            break;
+        case ChOP_DIV:
+            y = a / b;
+            y_dx = (a1 - y * b1) / b;
+            y_dxdx = (a2 - 2 * y_dx * b1 - y * b2) / b;
+            break;
+        case ChOP_POW:
+            y = pow(a, b);
+            if (a > 0) {
+                // y = exp(g), with g = b*ln(a)
+                double la = log(a);
+                double g1 = b1 * la + b * a1 / a;
+                double g2 = b2 * la + 2 * b1 * a1 / a + b * (a2 * a - a1 * a1) / (a * a);
+                y_dx = y * g1;
+                y_dxdx = y * (g2 + g1 * g1);
+            } else {
+                // not differentiable in closed form for a non-positive base
+                y_dx = (order > 0) ? ChFunction::Get_y_dx(x) : 0;
+                y_dxdx = (order > 1) ? ChFunction::Get_y_dxdx(x) : 0;
+            }
+            break;
+        case ChOP_MAX:
+            y = (a >= b) ? a : b;
+            y_dx = (a >= b) ? a1 : b1;
+            y_dxdx = (a >= b) ? a2 : b2;
+            break;
+        case ChOP_MIN:
+            y = (a <= b) ? a : b;
+            y_dx = (a <= b) ? a1 : b1;
+            y_dxdx = (a <= b) ? a2 : b2;
+            break;
+        case ChOP_MODULO: {
+            // y = a - n*b, with n = trunc(a/b) piecewise constant
+            y = fmod(a, b);
+            double n = (a - y) / b;
+            y_dx = a1 - n * b1;
+            y_dxdx = a2 - n * b2;
+            break;
+        }
+        default:
+            y = 0;
+            y_dx = 0;
+            y_dxdx = 0;
+            break;
+    }
+}
+
+double ChFunction_Operation::Get_y_dx(double x) const {
+    double y, y_dx, y_dxdx;
+    Evaluate(x, 1, y, y_dx, y_dxdx);
+    return y_dx;
+}
+
+double ChFunction_Operation::Get_y_dxdx(double x) const {
+    double y, y_dx, y_dxdx;
+    Evaluate(x, 2, y, y_dx, y_dxdx);
+    return y_dxdx;
+}
+
+void ChFunction_Operation::Get_y_all(double x, double& y, double& y_dx, double& y_dxdx) const {
+    Evaluate(x, 2, y, y_dx, y_dxdx);
 }
-*/
+
 void ChFunction_Operation::Estimate_x_range(double& xmin, double& xmax) const {
     double amin, amax, bmin, bmax;
     fa->Estimate_x_range(amin, amax);
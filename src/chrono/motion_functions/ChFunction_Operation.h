@@ -54,6 +54,9 @@ class ChApi ChFunction_Operation : public ChFunction {
     virtual FunctionType Get_Type() const override { return FUNCT_OPERATION; }
 
     virtual double Get_y(double x) const override;
+    virtual double Get_y_dx(double x) const override;
+    virtual double Get_y_dxdx(double x) const override;
+    virtual void Get_y_all(double x, double& y, double& y_dx, double& y_dxdx) const override;
 
     void Set_optype(eChOperation m_op) { op_type = m_op; }
     eChOperation Get_optype() { return op_type; }
@@ -88,6 +91,10 @@ class ChApi ChFunction_Operation : public ChFunction {
     /// @endcond
 
   private:
+    /// Evaluate the operation and its derivatives up to the given order (0, 1, or 2),
+    /// from the values and derivatives of the operands.
+    void Evaluate(double x, int order, double& y, double& y_dx, double& y_dxdx) const;
+
     std::shared_ptr<ChFunction> fa;
     std::shared_ptr<ChFunction> fb;
     eChOperation op_type;
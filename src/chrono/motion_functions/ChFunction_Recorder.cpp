@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -22,9 +23,10 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChFunction_Recorder)
 
-ChFunction_Recorder::ChFunction_Recorder(const ChFunction_Recorder& other) {
+ChFunction_Recorder::ChFunction_Recorder(const ChFunction_Recorder& other) : ChFunction(other) {
     m_points = other.m_points;
-    m_last = m_points.end();
+    m_uniform = other.m_uniform;
+    m_dx = other.m_dx;
 }
 
 void ChFunction_Recorder::Estimate_x_range(double& xmin, double& xmax) const {
@@ -41,24 +43,74 @@ void ChFunction_Recorder::Estimate_x_range(double& xmin, double& xmax) const {
 }
 
 void ChFunction_Recorder::AddPoint(double mx, double my, double mw) {
-    for (auto iter = m_points.rbegin(); iter != m_points.rend(); ++iter) {
-        double dist = mx - iter->x;
-        if (std::abs(dist) < std::numeric_limits<double>::epsilon()) {
-            // Overwrite current iterator
-            iter->x = mx;
-            iter->y = my;
-            iter->w = mw;
-            return;
-        } else if (dist > 0) {
-            // Insert before current iterator
-            ChRecPoint rec(mx, my, mw);
-            m_points.insert(iter.base(), rec);
+    const double eps = std::numeric_limits<double>::epsilon();
+
+    // Most tables are filled in order of increasing x: append at the end
+    if (m_points.empty() || mx - m_points.back().x >= eps) {
+        m_points.push_back(ChRecPoint(mx, my, mw));
+        size_t n = m_points.size();
+        if (n <= 3)
+            UpdateUniform();
+        else if (m_uniform)
+            m_uniform = std::abs(mx - m_points[n - 2].x - m_dx) <= 1e-6 * m_dx;
+        return;
+    }
+
+    // First point with x >= mx
+    auto iter = std::lower_bound(m_points.begin(), m_points.end(), mx,
+                                 [](const ChRecPoint& p, double x) { return p.x < x; });
+
+    if (iter != m_points.end() && iter->x - mx < eps) {
+        // Overwrite existing point
+        *iter = ChRecPoint(mx, my, mw);
+    } else if (iter != m_points.begin() && mx - (iter - 1)->x < eps) {
+        // Overwrite existing point
+        *(iter - 1) = ChRecPoint(mx, my, mw);
+    } else {
+        m_points.insert(iter, ChRecPoint(mx, my, mw));
+    }
+
+    UpdateUniform();
+}
+
+void ChFunction_Recorder::UpdateUniform() {
+    size_t n = m_points.size();
+    m_uniform = false;
+    m_dx = 0;
+    if (n < 2)
+        return;
+
+    double dx = (m_points.back().x - m_points.front().x) / (n - 1);
+    for (size_t i = 1; i < n; i++) {
+        if (std::abs(m_points[i].x - m_points[i - 1].x - dx) > 1e-6 * dx)
             return;
-        }
+    }
+    m_uniform = true;
+    m_dx = dx;
+}
+
+size_t ChFunction_Recorder::FindInterval(double x, size_t hint) const {
+    size_t n = m_points.size();
+
+    // Candidate interval: computed directly for equally spaced points, else the caller's hint
+    size_t i = m_uniform ? (size_t)((x - m_points.front().x) / m_dx) : hint;
+    if (i > n - 2)
+        i = n - 2;
+
+    // Check the candidate interval and its neighbors
+    if (x < m_points[i].x) {
+        if (i > 0 && x >= m_points[i - 1].x)
+            return i - 1;
+    } else if (x <= m_points[i + 1].x) {
+        return i;
+    } else if (i + 2 < n && x <= m_points[i + 2].x) {
+        return i + 1;
     }
 
-    // Insert in front of list
-    m_points.push_front(ChRecPoint(mx, my, mw));
+    // Binary search for the first point with x_j >= x (j >= 1, since x > x_0)
+    auto iter = std::lower_bound(m_points.begin() + 1, m_points.end(), x,
+                                 [](const ChRecPoint& p, double x) { return p.x < x; });
+    return (size_t)(iter - m_points.begin()) - 1;
 }
 
 double Interpolate_y(double x, const ChRecPoint& p1, const ChRecPoint& p2) {
@@ -66,6 +118,11 @@ double Interpolate_y(double x, const ChRecPoint& p1, const ChRecPoint& p2) {
 }
 
 double ChFunction_Recorder::Get_y(double x) const {
+    size_t cursor = 0;
+    return Get_y(x, cursor);
+}
+
+double ChFunction_Recorder::Get_y(double x, size_t& cursor) const {
     if (m_points.empty()) {
         return 0;
     }
@@ -79,31 +136,15 @@ double ChFunction_Recorder::Get_y(double x) const {
     }
 
     // At this point we are guaranteed that there are at least two records.
+    cursor = FindInterval(x, cursor);
+    return Interpolate_y(x, m_points[cursor], m_points[cursor + 1]);
+}
 
-    if (m_last == m_points.end()) {
-        m_last = m_points.begin();
-    }
-
-    if (x > m_last->x) {
-        // Search to the right
-        for (auto iter = m_last; iter != m_points.end(); ++iter) {
-            if (x <= iter->x) {
-                return Interpolate_y(x, *m_last, *iter);
-            }
-            m_last = iter;
-        }
-    } else {
-        // Search to the left
-        for (auto iter = m_last; iter != m_points.begin();) {
-            --iter;
-            if (x >= iter->x) {
-                return Interpolate_y(x, *iter, *m_last);
-            }
-            m_last = iter;
-        }
-    }
-
-    return 0;
+void ChFunction_Recorder::Get_y(const std::vector<double>& x, std::vector<double>& y) const {
+    y.resize(x.size());
+    size_t cursor = 0;
+    for (size_t i = 0; i < x.size(); i++)
+        y[i] = Get_y(x[i], cursor);
 }
 
 double ChFunction_Recorder::Get_y_dx(double x) const {
@@ -121,8 +162,8 @@ void ChFunction_Recorder::ArchiveOUT(ChArchiveOut& marchive) {
     marchive.VersionWrite<ChFunction_Recorder>();
     // serialize parent class
     ChFunction::ArchiveOUT(marchive);
-    // serialize all member data: copy to vector and store
-    std::vector<ChRecPoint> tmpvect{std::begin(m_points), std::end(m_points)};
+    // serialize all member data
+    std::vector<ChRecPoint> tmpvect = m_points;
     marchive << CHNVP(tmpvect);
 }
 
@@ -131,11 +172,11 @@ void ChFunction_Recorder::ArchiveIN(ChArchiveIn& marchive) {
     int version = marchive.VersionRead<ChFunction_Recorder>();
     // deserialize parent class
     ChFunction::ArchiveIN(marchive);
-    // stream in all member data: load vector of points and copy to list
+    // stream in all member data
     std::vector<ChRecPoint> tmpvect;
     marchive >> CHNVP(tmpvect);
-    m_points.clear();
-    std::copy(tmpvect.begin(), tmpvect.end(), std::back_inserter(m_points));
+    m_points = tmpvect;
+    UpdateUniform();
 }
 
 }  // end namespace chrono
@@ -15,8 +15,7 @@
 #ifndef CHFUNCT_RECORDER_H
 #define CHFUNCT_RECORDER_H
 
-#include <iterator>
-#include <list>
+#include <vector>
 
 #include "chrono/motion_functions/ChFunction_Base.h"
 
@@ -51,13 +50,20 @@ class ChApi ChRecPoint {
 ///
 /// y = interpolation of array of (x,y) data,
 ///     where (x,y) points can be inserted randomly.
+///
+/// The points are stored contiguously, sorted by increasing x. Lookup is a binary search, or
+/// a direct index computation if the points are equally spaced in x. Evaluation does not
+/// modify the function, so a recorder can be evaluated concurrently from several threads.
+/// Callers that evaluate at nearby values of x (e.g. once per step) can keep their own
+/// cursor, which makes the lookup O(1) in the common case.
 class ChApi ChFunction_Recorder : public ChFunction {
   private:
-    std::list<ChRecPoint> m_points;  ///< the list of points
-    mutable std::list<ChRecPoint>::const_iterator m_last;
+    std::vector<ChRecPoint> m_points;  ///< points, sorted by increasing x
+    bool m_uniform;                    ///< true if the points are equally spaced in x
+    double m_dx;                       ///< point spacing (only if uniform)
 
   public:
-    ChFunction_Recorder() : m_last(m_points.end()) {}
+    ChFunction_Recorder() : m_uniform(false), m_dx(0) {}
     ChFunction_Recorder(const ChFunction_Recorder& other);
     ~ChFunction_Recorder() {}
 
@@ -70,14 +76,27 @@ class ChApi ChFunction_Recorder : public ChFunction {
     virtual double Get_y_dx(double x) const override;
     virtual double Get_y_dxdx(double x) const override;
 
+    /// Evaluate the function at x, starting the lookup from the interval index in 'cursor'.
+    /// The cursor is owned by the caller (initialize it to 0) and is updated to the interval
+    /// containing x, so that successive evaluations at nearby values of x are O(1).
+    double Get_y(double x, size_t& cursor) const;
+
+    /// Evaluate the function at all values in x. Lookups share a cursor, so this is most
+    /// efficient if the values in x are sorted.
+    void Get_y(const std::vector<double>& x, std::vector<double>& y) const;
+
     void AddPoint(double mx, double my, double mw = 1);
 
     void Reset() {
         m_points.clear();
-        m_last = m_points.end();
+        m_uniform = false;
+        m_dx = 0;
     }
 
-    const std::list<ChRecPoint>& GetPoints() { return m_points; }
+    const std::vector<ChRecPoint>& GetPoints() const { return m_points; }
+
+    /// Return true if the points are equally spaced in x (lookups are then O(1)).
+    bool IsUniform() const { return m_uniform; }
 
     virtual void Estimate_x_range(double& xmin, double& xmax) const override;
 
@@ -86,6 +105,14 @@ class ChApi ChFunction_Recorder : public ChFunction {
 
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
+
+  private:
+    /// Return the index i of the interval [x_i, x_{i+1}] containing x, starting the search
+    /// from interval 'hint'. Requires at least two points and x_0 < x < x_{n-1}.
+    size_t FindInterval(double x, size_t hint) const;
+
+    /// Check whether the points are equally spaced.
+    void UpdateUniform();
 };
 
 /// @} chrono_functions
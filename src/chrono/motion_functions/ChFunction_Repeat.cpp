@@ -34,6 +34,18 @@ double ChFunction_Repeat::Get_y(double x) const {
     return fa->Get_y(this->window_start + fmod(x + this->window_phase, this->window_length));
 }
 
+double ChFunction_Repeat::Get_y_dx(double x) const {
+    return fa->Get_y_dx(this->window_start + fmod(x + this->window_phase, this->window_length));
+}
+
+double ChFunction_Repeat::Get_y_dxdx(double x) const {
+    return fa->Get_y_dxdx(this->window_start + fmod(x + this->window_phase, this->window_length));
+}
+
+void ChFunction_Repeat::Get_y_all(double x, double& y, double& y_dx, double& y_dxdx) const {
+    fa->Get_y_all(this->window_start + fmod(x + this->window_phase, this->window_length), y, y_dx, y_dxdx);
+}
+
 void ChFunction_Repeat::Estimate_x_range(double& xmin, double& xmax) const {
     fa->Estimate_x_range(xmin, xmax);
 }
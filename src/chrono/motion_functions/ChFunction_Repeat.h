@@ -51,6 +51,9 @@ class ChApi ChFunction_Repeat : public ChFunction {
     virtual FunctionType Get_Type() const override { return FUNCT_REPEAT; }
 
     virtual double Get_y(double x) const override;
+    virtual double Get_y_dx(double x) const override;
+    virtual double Get_y_dxdx(double x) const override;
+    virtual void Get_y_all(double x, double& y, double& y_dx, double& y_dxdx) const override;
 
     void Set_window_start(double m_v) { window_start = m_v; }
     double Get_window_start() const { return window_start; }
@@ -284,6 +284,21 @@ double ChFunction_Sequence::Get_y_dxdx(double x) const {
     return res;
 }
 
+void ChFunction_Sequence::Get_y_all(double x, double& y, double& y_dx, double& y_dxdx) const {
+    y = 0;
+    y_dx = 0;
+    y_dxdx = 0;
+    for (auto iter = functions.begin(); iter != functions.end(); ++iter) {
+        if ((x >= iter->t_start) && (x < iter->t_end)) {
+            double localtime = x - iter->t_start;
+            iter->fx->Get_y_all(localtime, y, y_dx, y_dxdx);
+            y += iter->Iy + iter->Iydt * localtime + iter->Iydtdt * localtime * localtime;
+            y_dx += iter->Iydt + iter->Iydtdt * localtime;
+            y_dxdx += iter->Iydtdt;
+        }
+    }
+}
+
 double ChFunction_Sequence::Get_weight(double x) const {
     double res = 1.0;
     for (auto iter = functions.begin(); iter != functions.end(); ++iter) {
@@ -83,6 +83,7 @@ class ChApi ChFunction_Sequence : public ChFunction {
     virtual double Get_y(double x) const override;
     virtual double Get_y_dx(double x) const override;
     virtual double Get_y_dxdx(double x) const override;
+    virtual void Get_y_all(double x, double& y, double& y_dx, double& y_dxdx) const override;
 
     /// The sequence of functions starts at this x value.
     void Set_start(double m_start) { start = m_start; }
@@ -364,6 +364,19 @@ void ChLinkLock::Update(double time, bool update_assets) {
     ChPhysicsItem::Update(ChTime, update_assets);
 }
 
+// Flag the rows of the complete lock jacobians needed by the mask and by the active limits
+void ChLinkLock::GetRequiredLockRows(bool rows[7]) {
+    for (int i = 0; i < 7; i++)
+        rows[i] = mask.Constr_N(i).IsActive();
+
+    rows[0] |= limit_X && limit_X->IsActive();
+    rows[1] |= limit_Y && limit_Y->IsActive();
+    rows[2] |= limit_Z && limit_Z->IsActive();
+    rows[4] |= limit_Rx && limit_Rx->IsActive();
+    rows[5] |= limit_Ry && limit_Ry->IsActive();
+    rows[6] |= limit_Rz && limit_Rz->IsActive();
+}
+
 // Updates Cq1_temp, Cq2_temp, Qc_temp, etc., i.e. all LOCK-FORMULATION temp.matrices
 void ChLinkLock::UpdateState() {
     // ----------- SOME PRECALCULATED VARIABLES, to optimize speed
@@ -404,19 +417,27 @@ void ChLinkLock::UpdateState() {
     Cq2_temp.topRightCorner<3, 4>() = CqxT * Body2->GetA() * Q2star * body2Gl +         //
                                       marker2->GetA().transpose() * tmpStar * body2Gl;  // -- -* Cq2_temp(4-7)
 
-    {
-        ChStarMatrix44<> stempQ1(Qcross(Qconjugate(marker2->GetCoord().rot), Qconjugate(Body2->GetCoord().rot)));
-        ChStarMatrix44<> stempQ2(marker1->GetCoord().rot);
-        stempQ2.semiTranspose();
-        Cq1_temp.bottomRightCorner<4, 4>() = stempQ1 * stempQ2;  // =* == Cq1_temp(col 4-7, row 4-7) ... CqrR
-    }
+    // Rotational rows, one row of the 4x4 CqrR blocks at a time (only those actually used; e.g. none for a
+    // spherical joint and no e0 row for most joint types)
+    bool rows[7];
+    GetRequiredLockRows(rows);
 
-    {
-        ChStarMatrix44<> stempQ1(Qconjugate(marker2->GetCoord().rot));
-        ChStarMatrix44<> stempQ2(Qcross(Body1->GetCoord().rot, marker1->GetCoord().rot));
-        stempQ2.semiTranspose();
-        stempQ2.semiNegate();
-        Cq2_temp.bottomRightCorner<4, 4>() = stempQ1 * stempQ2;  // == =* Cq2_temp(col 4-7, row 4-7) ... CqrR
+    if (rows[3] || rows[4] || rows[5] || rows[6]) {
+        ChStarMatrix44<> stempQ1a(Qcross(Qconjugate(marker2->GetCoord().rot), Qconjugate(Body2->GetCoord().rot)));
+        ChStarMatrix44<> stempQ2a(marker1->GetCoord().rot);
+        stempQ2a.semiTranspose();
+
+        ChStarMatrix44<> stempQ1b(Qconjugate(marker2->GetCoord().rot));
+        ChStarMatrix44<> stempQ2b(Qcross(Body1->GetCoord().rot, marker1->GetCoord().rot));
+        stempQ2b.semiTranspose();
+        stempQ2b.semiNegate();
+
+        for (int i = 0; i < 4; i++) {
+            if (!rows[3 + i])
+                continue;
+            Cq1_temp.block<1, 4>(3 + i, 3) = stempQ1a.row(i) * stempQ2a;  // =* == Cq1_temp(col 4-7, row 4-7) ... CqrR
+            Cq2_temp.block<1, 4>(3 + i, 3) = stempQ1b.row(i) * stempQ2b;  // == =* Cq2_temp(col 4-7, row 4-7) ... CqrR
+        }
     }
 
     //--------- COMPLETE Qc VECTOR
@@ -2147,23 +2168,15 @@ void ChLinkLockLock::UpdateTime(double time) {
 
     // Update motion position/speed/acceleration by motion laws
     // as expressed by specific link CH functions
-    deltaC.pos.x() = motion_X->Get_y(time);
-    deltaC_dt.pos.x() = motion_X->Get_y_dx(time);
-    deltaC_dtdt.pos.x() = motion_X->Get_y_dxdx(time);
+    motion_X->Get_y_all(time, deltaC.pos.x(), deltaC_dt.pos.x(), deltaC_dtdt.pos.x());
 
-    deltaC.pos.y() = motion_Y->Get_y(time);
-    deltaC_dt.pos.y() = motion_Y->Get_y_dx(time);
-    deltaC_dtdt.pos.y() = motion_Y->Get_y_dxdx(time);
+    motion_Y->Get_y_all(time, deltaC.pos.y(), deltaC_dt.pos.y(), deltaC_dtdt.pos.y());
 
-    deltaC.pos.z() = motion_Z->Get_y(time);
-    deltaC_dt.pos.z() = motion_Z->Get_y_dx(time);
-    deltaC_dtdt.pos.z() = motion_Z->Get_y_dxdx(time);
+    motion_Z->Get_y_all(time, deltaC.pos.z(), deltaC_dt.pos.z(), deltaC_dtdt.pos.z());
 
     switch (angleset) {
         case AngleSet::ANGLE_AXIS:
-            ang = motion_ang->Get_y(time);
-            ang_dt = motion_ang->Get_y_dx(time);
-            ang_dtdt = motion_ang->Get_y_dxdx(time);
+            motion_ang->Get_y_all(time, ang, ang_dt, ang_dtdt);
 
             if ((ang != 0) || (ang_dt != 0) || (ang_dtdt != 0)) {
                 deltaC.rot = Q_from_AngAxis(ang, motion_axis);
@@ -2180,15 +2193,9 @@ void ChLinkLockLock::UpdateTime(double time) {
         case AngleSet::HPB:
         case AngleSet::RXYZ: {
             Vector vangles, vangles_dt, vangles_dtdt;
-            vangles.x() = motion_ang->Get_y(time);
-            vangles.y() = motion_ang2->Get_y(time);
-            vangles.z() = motion_ang3->Get_y(time);
-            vangles_dt.x() = motion_ang->Get_y_dx(time);
-            vangles_dt.y() = motion_ang2->Get_y_dx(time);
-            vangles_dt.z() = motion_ang3->Get_y_dx(time);
-            vangles_dtdt.x() = motion_ang->Get_y_dxdx(time);
-            vangles_dtdt.y() = motion_ang2->Get_y_dxdx(time);
-            vangles_dtdt.z() = motion_ang3->Get_y_dxdx(time);
+            motion_ang->Get_y_all(time, vangles.x(), vangles_dt.x(), vangles_dtdt.x());
+            motion_ang2->Get_y_all(time, vangles.y(), vangles_dt.y(), vangles_dtdt.y());
+            motion_ang3->Get_y_all(time, vangles.z(), vangles_dt.z(), vangles_dtdt.z());
             deltaC.rot = Angle_to_Quat(angleset, vangles);
             deltaC_dt.rot = AngleDT_to_QuatDT(angleset, vangles_dt, deltaC.rot);
             deltaC_dtdt.rot = AngleDTDT_to_QuatDTDT(angleset, vangles_dtdt, deltaC.rot);
@@ -2263,21 +2270,30 @@ void ChLinkLockLock::UpdateState() {
     Cq2_temp.topRightCorner<3, 4>() = CqxT * Body2->GetA() * Q2star * body2Gl +         //
                                       marker2->GetA().transpose() * tmpStar * body2Gl;  // -- -* Cq2_temp(4-7)
 
-    {
-        ChStarMatrix44<> stempQ1(Qcross(Qconjugate(marker2->GetCoord().rot), Qconjugate(Body2->GetCoord().rot)));
-        ChStarMatrix44<> stempQ2(marker1->GetCoord().rot);
-        ChStarMatrix44<> stempDC(Qconjugate(deltaC.rot));
-        stempQ2.semiTranspose();
-        Cq1_temp.bottomRightCorner<4, 4>() = stempDC * stempQ1 * stempQ2;  // =* == Cq1_temp(col 4-7, row 4-7) ... CqrR
-    }
+    // Rotational rows, one row of the 4x4 CqrR blocks at a time (only those actually used)
+    bool rows[7];
+    GetRequiredLockRows(rows);
 
-    {
-        ChStarMatrix44<> stempQ1(Qconjugate(marker2->GetCoord().rot));
-        ChStarMatrix44<> stempQ2(Qcross(Body1->GetCoord().rot, marker1->GetCoord().rot));
+    if (rows[3] || rows[4] || rows[5] || rows[6]) {
         ChStarMatrix44<> stempDC(Qconjugate(deltaC.rot));
-        stempQ2.semiTranspose();
-        stempQ2.semiNegate();
-        Cq2_temp.bottomRightCorner<4, 4>() = stempDC * stempQ1 * stempQ2;  // == =* Cq2_temp(col 4-7, row 4-7) ... CqrR
+
+        ChStarMatrix44<> stempQ1a(Qcross(Qconjugate(marker2->GetCoord().rot), Qconjugate(Body2->GetCoord().rot)));
+        ChStarMatrix44<> stempQ2a(marker1->GetCoord().rot);
+        stempQ2a.semiTranspose();
+
+        ChStarMatrix44<> stempQ1b(Qconjugate(marker2->GetCoord().rot));
+        ChStarMatrix44<> stempQ2b(Qcross(Body1->GetCoord().rot, marker1->GetCoord().rot));
+        stempQ2b.semiTranspose();
+        stempQ2b.semiNegate();
+
+        for (int i = 0; i < 4; i++) {
+            if (!rows[3 + i])
+                continue;
+            // =* == Cq1_temp(col 4-7, row 4-7) ... CqrR
+            Cq1_temp.block<1, 4>(3 + i, 3) = (stempDC.row(i) * stempQ1a) * stempQ2a;
+            // == =* Cq2_temp(col 4-7, row 4-7) ... CqrR
+            Cq2_temp.block<1, 4>(3 + i, 3) = (stempDC.row(i) * stempQ1b) * stempQ2b;
+        }
     }
 
     //--------- COMPLETE Qc VECTOR
@@ -251,6 +251,11 @@ class ChApi ChLinkLock : public ChLinkMarkers {
 
     void ChangeLinkType(LinkType new_link_type);
 
+    /// Flag the rows of the complete lock jacobians Cq1_temp, Cq2_temp (ordered as x,y,z,e0,e1,e2,e3) that must be
+    /// evaluated in UpdateState, i.e. the rows of the constraints active in the mask and those used by active limits.
+    /// Rows not flagged are left untouched. Derived classes using additional rows must extend this set.
+    virtual void GetRequiredLockRows(bool rows[7]);
+
 
     // Extend parent functions to account for any ChLinkLimit objects.
     ////virtual void IntLoadResidual_F(const unsigned int off,	ChVectorDynamic<>& R, const double c );
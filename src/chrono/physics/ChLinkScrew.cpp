@@ -33,6 +33,13 @@ ChLinkScrew::ChLinkScrew(const ChLinkScrew& other) : ChLinkLock(other) {
     tau = other.tau;
 }
 
+void ChLinkScrew::GetRequiredLockRows(bool rows[7]) {
+    ChLinkLock::GetRequiredLockRows(rows);
+    rows[2] = true;
+    rows[3] = true;
+    rows[6] = true;
+}
+
 void ChLinkScrew::UpdateState() {
     // First, compute everything as it were a normal "revolute" joint, on z axis...
     ChLinkLock::UpdateState();
@@ -50,6 +50,10 @@ class ChApi ChLinkScrew : public ChLinkLock {
 
     /// Method to allow deserialization of transient data from archives.
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
+
+  protected:
+    /// The screw constraint also uses the e0 and e3 rows of the complete lock jacobians.
+    virtual void GetRequiredLockRows(bool rows[7]) override;
 };
 
 CH_CLASS_VERSION(ChLinkScrew,0)
@@ -114,6 +114,7 @@ ChSystem::ChSystem(const ChSystem& other) {
     ncontacts = other.ncontacts;
 
     collision_callbacks = other.collision_callbacks;
+    step_callbacks = other.step_callbacks;
 
     last_err = other.last_err;
 }
@@ -372,6 +373,9 @@ void ChSystem::SetTimestepperType(ChTimestepper::Type type) {
         case ChTimestepper::Type::NEWMARK:
             timestepper = chrono_types::make_shared<ChTimestepperNewmark>(this);
             break;
+        case ChTimestepper::Type::CENTRAL_DIFFERENCE:
+            timestepper = chrono_types::make_shared<ChTimestepperCentralDifference>(this);
+            break;
         default:
             throw ChException("SetTimestepperType: timestepper not supported");
     }
@@ -1176,6 +1180,52 @@ double ChSystem::ComputeCollisions() {
     return mretC;
 }
 
+// -----------------------------------------------------------------------------
+
+// Callback collecting the pairs of contacting objects (ordered by address).
+class ContactPairCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    ContactPairCollector(std::vector<std::pair<ChContactable*, ChContactable*>>& pairs) : m_pairs(pairs) {}
+
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        if (contactobjB < contactobjA)
+            std::swap(contactobjA, contactobjB);
+        m_pairs.push_back(std::make_pair(contactobjA, contactobjB));
+        return true;
+    }
+
+  private:
+    std::vector<std::pair<ChContactable*, ChContactable*>>& m_pairs;
+};
+
+void ChSystem::UpdateContactPairs(bool& onset, bool& changed) {
+    std::vector<std::pair<ChContactable*, ChContactable*>> pairs;
+    pairs.reserve(ncontacts);
+    contact_container->ReportAllContacts(chrono_types::make_shared<ContactPairCollector>(pairs));
+    std::sort(pairs.begin(), pairs.end());
+
+    changed = (pairs != contact_pairs);
+    onset = false;
+    if (changed) {
+        for (const auto& pair : pairs) {
+            if (!std::binary_search(contact_pairs.begin(), contact_pairs.end(), pair)) {
+                onset = true;
+                break;
+            }
+        }
+    }
+
+    contact_pairs.swap(pairs);
+}
+
 // =============================================================================
 //   PHYSICAL OPERATIONS
 // =============================================================================
@@ -1307,6 +1357,24 @@ bool ChSystem::Integrate_Y() {
     if (GetContactMethod() == ChContactMethod::NSC && (ncontacts_old != 0 || ncontacts != 0))
         is_updated = false;
 
+    // If needed by the implicit integrator, track changes in the set of contacting pairs:
+    //   - notify the HHT integrator of contact onset (used to limit the step size if using error control)
+    //   - force re-evaluation of a Newton matrix reused across steps if the contact set changed
+    if (auto implicit = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(timestepper)) {
+        auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(timestepper);
+        bool track_onset = hht && hht->GetErrorControl();
+        bool track_changes = implicit->GetJacobianReuse() > 0;
+        if (track_onset || track_changes) {
+            bool onset;
+            bool changed;
+            UpdateContactPairs(onset, changed);
+            if (track_onset && onset)
+                hht->NotifyEvent();
+            if (track_changes && changed)
+                implicit->InvalidateJacobian();
+        }
+    }
+
     // Counts dofs, number of constraints, statistics, etc.
     // Note: this must be invoked at all times (regardless of the flag is_updated), as various physics items may use
     // their own Setup to perform operations at the beginning of a step.
@@ -1351,6 +1419,10 @@ bool ChSystem::Integrate_Y() {
     // Time elapsed for step
     timer_step.stop();
 
+    // Invoke any user-provided end-of-step callbacks
+    for (size_t ic = 0; ic < step_callbacks.size(); ic++)
+        step_callbacks[ic]->OnEndStep(this);
+
     // Tentatively mark system as unchanged (i.e., no updated necessary)
     is_updated = true;
 
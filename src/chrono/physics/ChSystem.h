@@ -467,6 +467,11 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// using the NSC formulation, but are included when using the SMC formulation.
     virtual ChVector<> GetBodyAppliedTorque(ChBody* body);
 
+    /// Collect the pairs of contactable objects currently in contact and compare with those at the previous call.
+    /// On return, 'onset' is true if some pair of objects came into contact and 'changed' is true if the contact
+    /// set differs from the previous one (pairs added or removed, or a different number of contacts in a pair).
+    void UpdateContactPairs(bool& onset, bool& changed);
+
   public:
     /// Counts the number of bodies and links.
     /// Computes the offsets of object states in the global state. Assumes that offset_x, offset_w, and offset_L are
@@ -656,6 +661,23 @@ class ChApi ChSystem : public ChIntegrableIIorder {
         collision_callbacks.push_back(callback);
     }
 
+    /// Class to be used as a callback interface for user defined actions performed
+    /// at the end of each integration step (after contact forces were gathered in the bodies).
+    /// For example, simulation results can be recorded to an output file.
+    class ChApi CustomStepCallback {
+      public:
+        virtual ~CustomStepCallback() {}
+        virtual void OnEndStep(ChSystem* msys) {}
+    };
+
+    /// Specify a callback object to be invoked at the end of each integration step.
+    /// Multiple such callback objects can be registered with a system. If present,
+    /// their OnEndStep() method is invoked, in the order in which they were registered,
+    /// at the end of each call to DoStepDynamics().
+    void RegisterCustomStepCallback(std::shared_ptr<CustomStepCallback> callback) {
+        step_callbacks.push_back(callback);
+    }
+
     /// For higher performance (ex. when GPU coprocessors are available) you can create your own custom
     /// collision engine (inherited from ChCollisionSystem) and plug it into the system using this function. 
     /// Note: use only _before_ you start adding colliding bodies to the system!
@@ -893,9 +915,13 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     int ncontacts;  ///< total number of contacts
 
+    /// Sorted list of contacting object pairs, one entry per contact (only tracked if needed by the timestepper)
+    std::vector<std::pair<ChContactable*, ChContactable*>> contact_pairs;
+
     std::shared_ptr<collision::ChCollisionSystem> collision_system;  ///< collision engine
 
     std::vector<std::shared_ptr<CustomCollisionCallback>> collision_callbacks;
+    std::vector<std::shared_ptr<CustomStepCallback>> step_callbacks;
 
     std::unique_ptr<ChMaterialCompositionStrategy> composition_strategy; /// material composition strategy
 
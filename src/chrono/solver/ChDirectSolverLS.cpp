@@ -14,6 +14,9 @@
 
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/utils/ChTraceProfiler.h"
+
+#include <algorithm>
 
 #define SPM_DEF_SPARSITY 0.9  ///< default predicted sparsity (in [0,1])
 
@@ -109,6 +112,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
 }
 
 double ChDirectSolverLS::Solve(ChSystemDescriptor& sysd) {
+    CH_PROFILE_ZONE("ChDirectSolverLS::Solve");
     // Assemble the problem right-hand side vector
     m_timer_solve_assembly.start();
     sysd.ConvertToMatrixForm(nullptr, &m_rhs);
@@ -227,4 +231,244 @@ void ChSolverSparseQR::PrintErrorMessage() {
     }
 }
 
+// ---------------------------------------------------------------------------
+
+bool ChSolverTreeLU::Setup(ChSystemDescriptor& sysd) {
+    // Record the first row of each active variable block (offsets are assigned in list order)
+    m_var_start.clear();
+    m_num_vars = 0;
+    for (auto var : sysd.GetVariablesList()) {
+        if (var->IsActive() && var->Get_ndof() > 0) {
+            m_var_start.push_back(var->GetOffset());
+            m_num_vars += var->Get_ndof();
+        }
+    }
+
+    return ChDirectSolverLS::Setup(sysd);
+}
+
+bool ChSolverTreeLU::AnalyzeTree() {
+    m_block_start.clear();
+    m_block_size.clear();
+    m_row_block.assign(m_dim, -1);
+
+    // One block for each variable
+    for (size_t i = 0; i < m_var_start.size(); i++) {
+        int end = (i + 1 < m_var_start.size()) ? m_var_start[i + 1] : m_num_vars;
+        m_block_start.push_back(m_var_start[i]);
+        m_block_size.push_back(end - m_var_start[i]);
+        for (int r = m_var_start[i]; r < end; r++)
+            m_row_block[r] = (int)i;
+    }
+
+    // One block for each group of consecutive constraint rows acting on the same set of variables
+    std::vector<int> prev_vars;
+    std::vector<int> vars;
+    for (int r = m_num_vars; r < m_dim; r++) {
+        vars.clear();
+        for (ChSparseMatrix::InnerIterator it(m_mat, r); it; ++it) {
+            if (it.col() < m_num_vars)
+                vars.push_back(m_row_block[it.col()]);
+        }
+        std::sort(vars.begin(), vars.end());
+        vars.erase(std::unique(vars.begin(), vars.end()), vars.end());
+        if (r == m_num_vars || vars != prev_vars) {
+            m_block_start.push_back(r);
+            m_block_size.push_back(0);
+        }
+        m_block_size.back()++;
+        m_row_block[r] = (int)m_block_start.size() - 1;
+        std::swap(prev_vars, vars);
+    }
+
+    int nb = (int)m_block_start.size();
+    int nv = (int)m_var_start.size();
+
+    // Edges of the block graph (off-diagonal blocks with nonzeros)
+    std::vector<std::pair<int, int>> edges;
+    for (int r = 0; r < m_dim; r++) {
+        for (ChSparseMatrix::InnerIterator it(m_mat, r); it; ++it) {
+            int b1 = m_row_block[r];
+            int b2 = m_row_block[it.col()];
+            if (b1 != b2)
+                edges.push_back(std::make_pair(std::min(b1, b2), std::max(b1, b2)));
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    // The graph is a forest if no edge connects two blocks already in the same component
+    std::vector<int> component(nb);
+    for (int b = 0; b < nb; b++)
+        component[b] = b;
+    auto find = [&component](int b) {
+        while (component[b] != b) {
+            component[b] = component[component[b]];
+            b = component[b];
+        }
+        return b;
+    };
+    for (const auto& e : edges) {
+        int c1 = find(e.first);
+        int c2 = find(e.second);
+        if (c1 == c2)
+            return false;
+        component[c1] = c2;
+    }
+
+    // Block adjacency lists
+    std::vector<int> adj_start(nb + 1, 0);
+    std::vector<int> adj(2 * edges.size());
+    for (const auto& e : edges) {
+        adj_start[e.first + 1]++;
+        adj_start[e.second + 1]++;
+    }
+    for (int b = 0; b < nb; b++)
+        adj_start[b + 1] += adj_start[b];
+    std::vector<int> pos(adj_start.begin(), adj_start.end() - 1);
+    for (const auto& e : edges) {
+        adj[pos[e.first]++] = e.second;
+        adj[pos[e.second]++] = e.first;
+    }
+
+    // Breadth-first traversal of each tree. Constraint blocks attached to a single variable (e.g. joints to fixed
+    // bodies) have a zero diagonal block, so they are used as roots when available: as leaves they would be
+    // eliminated with a singular pivot.
+    m_parent.assign(nb, -2);
+    std::vector<int> queue;
+    queue.reserve(nb);
+    auto traverse = [&](int root) {
+        if (m_parent[root] != -2)
+            return;
+        m_parent[root] = -1;
+        size_t head = queue.size();
+        queue.push_back(root);
+        while (head < queue.size()) {
+            int b = queue[head++];
+            for (int k = adj_start[b]; k < adj_start[b + 1]; k++) {
+                if (m_parent[adj[k]] == -2) {
+                    m_parent[adj[k]] = b;
+                    queue.push_back(adj[k]);
+                }
+            }
+        }
+    };
+    for (int b = nv; b < nb; b++) {
+        if (adj_start[b + 1] - adj_start[b] <= 1)
+            traverse(b);
+    }
+    for (int b = 0; b < nb; b++)
+        traverse(b);
+
+    // Eliminate in reverse traversal order (children before parents)
+    m_order.assign(queue.rbegin(), queue.rend());
+
+    return true;
+}
+
+bool ChSolverTreeLU::FactorizeTree() {
+    int nb = (int)m_block_start.size();
+
+    // Extract the diagonal blocks and the off-diagonal blocks coupling each block j with its parent p
+    std::vector<ChMatrixDynamic<>> A_jj(nb);
+    std::vector<ChMatrixDynamic<>> A_jp(nb);
+    std::vector<ChMatrixDynamic<>> A_pj(nb);
+    for (int j = 0; j < nb; j++) {
+        int p = m_parent[j];
+        A_jj[j].setZero(m_block_size[j], m_block_size[j]);
+        if (p >= 0) {
+            A_jp[j].setZero(m_block_size[j], m_block_size[p]);
+            A_pj[j].setZero(m_block_size[p], m_block_size[j]);
+        }
+    }
+    for (int r = 0; r < m_dim; r++) {
+        int br = m_row_block[r];
+        for (ChSparseMatrix::InnerIterator it(m_mat, r); it; ++it) {
+            int bc = m_row_block[it.col()];
+            int lr = r - m_block_start[br];
+            int lc = (int)it.col() - m_block_start[bc];
+            if (br == bc)
+                A_jj[br](lr, lc) += it.value();
+            else if (m_parent[br] == bc)
+                A_jp[br](lr, lc) += it.value();
+            else
+                A_pj[bc](lr, lc) += it.value();
+        }
+    }
+
+    // Block elimination from the leaves to the roots
+    m_pivot.resize(nb);
+    m_W.resize(nb);
+    m_G.resize(nb);
+    for (int j : m_order) {
+        m_pivot[j].compute(A_jj[j]);
+        if (!m_pivot[j].isInvertible())
+            return false;
+        int p = m_parent[j];
+        if (p < 0)
+            continue;
+        m_G[j] = m_pivot[j].solve(A_jp[j]);
+        m_W[j] = A_pj[j] * m_pivot[j].inverse();
+        A_jj[p] -= A_pj[j] * m_G[j];
+    }
+
+    return true;
+}
+
+bool ChSolverTreeLU::FactorizeMatrix() {
+    m_is_tree = AnalyzeTree() && FactorizeTree();
+    if (m_is_tree)
+        return true;
+
+    // Not a tree (or singular pivot block): fall back to a general sparse factorization
+    m_engine.compute(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
+bool ChSolverTreeLU::SolveSystem() {
+    if (!m_is_tree) {
+        m_sol = m_engine.solve(m_rhs);
+        return (m_engine.info() == Eigen::Success);
+    }
+
+    m_sol = m_rhs;
+
+    // Forward elimination of the right-hand side, from the leaves to the roots
+    for (int j : m_order) {
+        int p = m_parent[j];
+        if (p >= 0)
+            m_sol.segment(m_block_start[p], m_block_size[p]) -=
+                m_W[j] * m_sol.segment(m_block_start[j], m_block_size[j]);
+    }
+
+    // Back substitution, from the roots to the leaves
+    for (auto it = m_order.rbegin(); it != m_order.rend(); ++it) {
+        int j = *it;
+        int p = m_parent[j];
+        ChVectorDynamic<> x = m_pivot[j].solve(m_sol.segment(m_block_start[j], m_block_size[j]));
+        if (p >= 0)
+            x -= m_G[j] * m_sol.segment(m_block_start[p], m_block_size[p]);
+        m_sol.segment(m_block_start[j], m_block_size[j]) = x;
+    }
+
+    return true;
+}
+
+void ChSolverTreeLU::PrintErrorMessage() {
+    // Failures can only occur in the fallback SparseLU solver
+    switch (m_engine.info()) {
+        case Eigen::Success:
+            GetLog() << "computation was successful\n";
+            break;
+        case Eigen::NumericalIssue:
+            GetLog() << "LU factorization reported a problem, zero diagonal for instance\n";
+            break;
+        case Eigen::InvalidInput:
+            GetLog() << "inputs are invalid, or the algorithm has been improperly called\n";
+            break;
+        default:
+            break;
+    }
+}
+
 }  // end namespace chrono
@@ -19,6 +19,8 @@
 #include "chrono/core/ChTimer.h"
 #include "chrono/solver/ChSolverLS.h"
 
+#include <vector>
+
 #include <Eigen/SparseLU>
 
 namespace chrono {
@@ -240,6 +242,64 @@ class ChApi ChSolverSparseQR : public ChDirectSolverLS {
     Eigen::SparseQR<ChSparseMatrix, Eigen::COLAMDOrdering<int>> m_engine;  ///< Eigen SparseQR solver
 };
 
+/// Linear-time direct solver for tree-structured mechanisms.\n
+/// The problem matrix is partitioned into blocks, one per active variable (e.g. body) and one per group of
+/// constraint rows acting on the same set of variables (e.g. joint). If the resulting block graph is a forest (no kinematic
+/// loops and no contacts closing loops), the system is solved by block elimination from the leaves to the roots of each
+/// tree, with dense factorizations of the (small) diagonal blocks only, at a cost linear in the number of bodies and
+/// joints. Otherwise, or if a pivot block is singular, the solver falls back to Eigen's SparseLU on the full matrix.\n
+/// Intended for long chains and serial manipulators (possibly attached to fixed bodies) integrated with implicit
+/// timesteppers. Cannot handle VI and complementarity problems, so it cannot be used with NSC formulations.\n
+/// See ChDirectSolverLS for more details.
+class ChApi ChSolverTreeLU : public ChDirectSolverLS {
+  public:
+    ChSolverTreeLU() : m_num_vars(0), m_is_tree(false) {}
+    ~ChSolverTreeLU() {}
+
+    /// Perform the solver setup operations.
+    /// Records the partition of the unknowns in variable blocks, then assembles and factorizes the problem matrix.
+    virtual bool Setup(ChSystemDescriptor& sysd) override;
+
+    /// Return true if the last factorization used the tree elimination (false if it fell back to SparseLU).
+    bool IsTreeStructured() const { return m_is_tree; }
+
+    /// Return the number of blocks in the last factorized problem.
+    int GetNumBlocks() const { return (int)m_block_start.size(); }
+
+  private:
+    /// Factorize the current sparse matrix and return true if successful.
+    virtual bool FactorizeMatrix() override;
+
+    /// Solve the linear system using the current factorization and right-hand side vector.
+    /// Load the solution vector (already of appropriate size) and return true if succesful.
+    virtual bool SolveSystem() override;
+
+    /// Display an error message corresponding to the last failure.
+    /// This function is only called if Factorize or Solve returned false.
+    virtual void PrintErrorMessage() override;
+
+    /// Partition the matrix in blocks and find an elimination order.
+    /// Return false if the block graph is not a forest.
+    bool AnalyzeTree();
+
+    /// Block elimination from leaves to roots. Return false if a pivot block is singular.
+    bool FactorizeTree();
+
+    int m_num_vars;                       ///< number of variable rows (constraint rows follow)
+    std::vector<int> m_var_start;         ///< first row of each variable block
+    std::vector<int> m_block_start;       ///< first row of each block
+    std::vector<int> m_block_size;        ///< number of rows in each block
+    std::vector<int> m_row_block;         ///< block index of each row
+    std::vector<int> m_parent;            ///< parent of each block (-1 for roots)
+    std::vector<int> m_order;             ///< elimination order (children before parents)
+    std::vector<Eigen::FullPivLU<ChMatrixDynamic<>>> m_pivot;  ///< factorized pivot blocks
+    std::vector<ChMatrixDynamic<>> m_W;   ///< A_pj * inv(A_jj), for each non-root block j with parent p
+    std::vector<ChMatrixDynamic<>> m_G;   ///< inv(A_jj) * A_jp, for each non-root block j with parent p
+    bool m_is_tree;                       ///< was the tree elimination used?
+
+    Eigen::SparseLU<ChSparseMatrix, Eigen::COLAMDOrdering<int>> m_engine;  ///< fallback Eigen SparseLU solver
+};
+
 /// @} chrono_solver
 
 }  // end namespace chrono
@@ -21,6 +21,7 @@
 #include <string>
 #include <valarray>
 #include <vector>
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -72,6 +73,7 @@ double ChSolverAPGD::Res4(ChSystemDescriptor& sysd) {
 }
 
 double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
+    CH_PROFILE_ZONE("ChSolverAPGD::Solve");
     bool verbose = false;
     const std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     const std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
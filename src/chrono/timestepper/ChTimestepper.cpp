@@ -12,9 +12,11 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -36,6 +38,7 @@ class my_enum_mappers : public ChTimestepper {
     CH_ENUM_VAL(Type::EULER_EXPLICIT);
     CH_ENUM_VAL(Type::LEAPFROG);
     CH_ENUM_VAL(Type::NEWMARK);
+    CH_ENUM_VAL(Type::CENTRAL_DIFFERENCE);
     CH_ENUM_VAL(Type::CUSTOM);
     CH_ENUM_MAPPER_END(Type);
 };
@@ -73,6 +76,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerExpl)
 // Euler explicit timestepper.
 // This performs the typical  y_new = y+ dy/dt * dt integration with Euler formula.
 void ChTimestepperEulerExpl::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperEulerExpl::Advance");
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -109,6 +113,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerExplIIorder)
 //    v_new = v + a * dt
 // integration with Euler formula.
 void ChTimestepperEulerExplIIorder::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperEulerExplIIorder::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -147,6 +152,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerSemiImplicit)
 //    x_new = x + v_new * dt
 // integration with Euler semi-implicit formula.
 void ChTimestepperEulerSemiImplicit::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperEulerSemiImplicit::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -180,6 +186,7 @@ CH_FACTORY_REGISTER(ChTimestepperRungeKuttaExpl)
 
 // Performs a step of a 4th order explicit Runge-Kutta integration scheme.
 void ChTimestepperRungeKuttaExpl::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperRungeKuttaExpl::Advance");
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -226,6 +233,7 @@ CH_FACTORY_REGISTER(ChTimestepperHeun)
 
 // Performs a step of a Heun explicit integrator. It is like a 2nd Runge Kutta.
 void ChTimestepperHeun::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperHeun::Advance");
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -269,6 +277,7 @@ CH_FACTORY_REGISTER(ChTimestepperLeapfrog)
 // Suggestion: use the ChTimestepperEulerSemiImplicit, it gives
 // the same accuracy with a bit of faster performance.
 void ChTimestepperLeapfrog::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperLeapfrog::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -301,11 +310,75 @@ void ChTimestepperLeapfrog::Advance(const double dt) {
 
 // -----------------------------------------------------------------------------
 
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChTimestepperCentralDifference)
+
+// Explicit central difference with lumped mass, in the velocity form
+//    a = Md^-1 * f(x, v, t)
+//    v_new = v + a * h
+//    x_new = x + v_new * h
+// repeated over substeps h <= max_substep.
+void ChTimestepperCentralDifference::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperCentralDifference::Advance");
+    // downcast
+    ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
+
+    if (mintegrable->GetNconstr() > 0)
+        throw ChException("ChTimestepperCentralDifference: constraints are not supported.");
+
+    // setup main vectors
+    mintegrable->StateSetup(X, V, A);
+
+    // setup auxiliary vectors
+    int nv = mintegrable->GetNcoords_v();
+    R.setZero(nv);
+    L.setZero(0);
+
+    mintegrable->StateGather(X, V, T);  // state <- system
+
+    // Lumped mass, as row sums of the mass matrix (i.e., Md = M * 1)
+    if (Md.size() != nv) {
+        ChVectorDynamic<> ones = ChVectorDynamic<>::Ones(nv);
+        Md.setZero(nv);
+        mintegrable->LoadResidual_Mv(Md, ones, 1.0);
+        if (nv > 0 && Md.minCoeff() <= 0)
+            throw ChException("ChTimestepperCentralDifference: non-positive lumped mass.");
+    }
+
+    num_substeps = (max_substep > 0) ? std::max(1, (int)std::ceil(dt / max_substep - 1e-10)) : 1;
+    double h = dt / num_substeps;
+
+    for (int is = 0; is < num_substeps; is++) {
+        // forces at current state (the system is up-to-date)
+        R.setZero();
+        mintegrable->LoadResidual_F(R, 1.0);
+
+        // accelerations and velocities (no linear solve, thanks to the diagonal mass)
+#pragma omp parallel for
+        for (int i = 0; i < nv; i++) {
+            A(i) = R(i) / Md(i);
+            V(i) += A(i) * h;
+        }
+
+        // positions
+        X = X + V * h;
+        T += h;
+
+        mintegrable->StateScatter(X, V, T, true);  // state -> system
+    }
+
+    mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data
+    mintegrable->StateScatterReactions(L);     // -> system auxiliary data
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerImplicit)
 
 // Performs a step of Euler implicit for II order systems
 void ChTimestepperEulerImplicit::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperEulerImplicit::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -337,6 +410,10 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     numsetups = 0;
     numsolves = 0;
 
+    int nv = mintegrable->GetNcoords_v();
+    int nc = mintegrable->GetNconstr();
+    bool converged = false;
+
     for (int i = 0; i < this->GetMaxiters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
         R.setZero();
@@ -350,8 +427,14 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             GetLog() << " Euler iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
                      << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << "\n";
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
+        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+            converged = true;
             break;
+        }
+
+        // Re-evaluate the Newton matrix if needed (always, unless reusing it across iterations and steps)
+        MonitorConvergenceRate(i, R.lpNorm<Eigen::Infinity>());
+        bool call_setup = JacobianUpdateNeeded(dt, nv, nc);
 
         mintegrable->StateSolveCorrection(  //
             Dv, Dl, R, Qc,                  //
@@ -361,12 +444,15 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always call the solver's Setup
+            call_setup                      // call the solver's Setup?
         );
 
         numiters++;
-        numsetups++;
         numsolves++;
+        if (call_setup) {
+            numsetups++;
+            JacobianUpdated(dt, nv, nc);
+        }
 
         Dl *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
@@ -376,6 +462,11 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
         Xnew = X + Vnew * dt;
     }
 
+    // Force a matrix re-evaluation at the next step if the Newton iteration did not converge
+    if (!converged)
+        InvalidateJacobian();
+    jacobian_age++;
+
     mintegrable->StateScatterAcceleration(
         (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
@@ -399,6 +490,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicitLinearized)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the typical Anitescu stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperEulerImplicitLinearized::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -469,6 +561,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicitProjected)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the Tasora stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperEulerImplicitProjected::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -562,6 +655,7 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidal)
 // order in constraint reactions. Use damped HHT or damped Newmark for
 // more advanced options.
 void ChTimestepperTrapezoidal::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperTrapezoidal::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -599,6 +693,10 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
     numsetups = 0;
     numsolves = 0;
 
+    int nv = mintegrable->GetNcoords_v();
+    int nc = mintegrable->GetNconstr();
+    bool converged = false;
+
     for (int i = 0; i < this->GetMaxiters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
         R = Rold;
@@ -612,8 +710,14 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
             GetLog() << " Trapezoidal iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
                      << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << "\n";
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
+        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+            converged = true;
             break;
+        }
+
+        // Re-evaluate the Newton matrix if needed (always, unless reusing it across iterations and steps)
+        MonitorConvergenceRate(i, R.lpNorm<Eigen::Infinity>());
+        bool call_setup = JacobianUpdateNeeded(dt, nv, nc);
 
         mintegrable->StateSolveCorrection(  //
             Dv, Dl, R, Qc,                  //
@@ -623,12 +727,15 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always force a call to the solver's Setup() function
+            call_setup                      // call the solver's Setup?
         );
 
         numiters++;
-        numsetups++;
         numsolves++;
+        if (call_setup) {
+            numsetups++;
+            JacobianUpdated(dt, nv, nc);
+        }
 
         Dl *= (2.0 / dt);  // Note it is not -(2.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
@@ -638,6 +745,11 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
         Xnew = X + ((Vnew + V) * (dt * 0.5));  // Xnew = Xold + h/2(Vnew+Vold)
     }
 
+    // Force a matrix re-evaluation at the next step if the Newton iteration did not converge
+    if (!converged)
+        InvalidateJacobian();
+    jacobian_age++;
+
     mintegrable->StateScatterAcceleration(
         (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
@@ -657,6 +769,7 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidalLinearized)
 
 // Performs a step of trapezoidal implicit linearized for II order systems
 void ChTimestepperTrapezoidalLinearized::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperTrapezoidalLinearized::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -737,6 +850,7 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidalLinearized2)
 // Performs a step of trapezoidal implicit linearized for II order systems
 //*** SIMPLIFIED VERSION -DOES NOT WORK - PREFER ChTimestepperTrapezoidalLinearized
 void ChTimestepperTrapezoidalLinearized2::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperTrapezoidalLinearized2::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -822,6 +936,7 @@ void ChTimestepperNewmark::SetGammaBeta(double mgamma, double mbeta) {
 
 // Performs a step of Newmark constrained implicit for II order DAE systems
 void ChTimestepperNewmark::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperNewmark::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -44,6 +44,7 @@ class ChApi ChTimestepper {
         EULER_EXPLICIT = 8,
         LEAPFROG = 9,
         NEWMARK = 10,
+        CENTRAL_DIFFERENCE = 11,
         CUSTOM = 20
     };
 
@@ -183,9 +184,32 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     int numsetups;  ///< number of calls to the solver's Setup function
     int numsolves;  ///< number of calls to the solver's Solve function
 
+    int jacobian_max_age;      ///< maximum number of steps a Newton matrix can be reused over (0: no reuse)
+    double jacobian_max_rate;  ///< Newton convergence rate above which the matrix is re-evaluated
+    int jacobian_age;          ///< number of steps since the last Newton matrix update
+    double jacobian_h;         ///< step size used in the last Newton matrix update
+    int jacobian_nv;           ///< number of velocity coordinates at the last Newton matrix update
+    int jacobian_nc;           ///< number of constraints at the last Newton matrix update
+    bool jacobian_valid;       ///< false if the Newton matrix must be re-evaluated
+    double conv_nrm_prev;      ///< norm of the previous Newton update (for convergence rate monitoring)
+
   public:
     ChImplicitIterativeTimestepper()
-        : maxiters(6), reltol(1e-4), abstolS(1e-10), abstolL(1e-10), numiters(0), numsetups(0), numsolves(0) {}
+        : maxiters(6),
+          reltol(1e-4),
+          abstolS(1e-10),
+          abstolL(1e-10),
+          numiters(0),
+          numsetups(0),
+          numsolves(0),
+          jacobian_max_age(0),
+          jacobian_max_rate(0.5),
+          jacobian_age(0),
+          jacobian_h(0),
+          jacobian_nv(-1),
+          jacobian_nc(-1),
+          jacobian_valid(false),
+          conv_nrm_prev(0) {}
     virtual ~ChImplicitIterativeTimestepper() {}
 
     /// Set the max number of iterations using the Newton Raphson procedure
@@ -216,6 +240,26 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
         abstolL = abs_tol;
     }
 
+    /// Set the policy for reusing the (factorized) Newton matrix across integration steps.
+    /// If max_steps > 0, the matrix evaluated at one step is kept for up to max_steps subsequent steps and
+    /// is only re-evaluated when the step size or the problem size changes, when the Newton convergence rate
+    /// (ratio of successive update norms) exceeds max_rate, when the Newton iteration fails, or when
+    /// InvalidateJacobian() is called. When used with a ChSystem, the latter is done whenever the set of contacts
+    /// changes (a pair of contactable objects comes into or out of contact, or the number of contacts between two
+    /// objects changes), which also covers SMC contacts that are replaced without a change in the total count.
+    /// Requires a linear solver that retains its factorization between Solve() calls (e.g., a direct sparse
+    /// solver). By default (max_steps = 0), the matrix is re-evaluated at the beginning of each step.
+    void SetJacobianReuse(int max_steps, double max_rate = 0.5) {
+        jacobian_max_age = max_steps;
+        jacobian_max_rate = max_rate;
+    }
+
+    /// Return the maximum number of steps over which the Newton matrix can be reused (0: no reuse).
+    int GetJacobianReuse() const { return jacobian_max_age; }
+
+    /// Force a re-evaluation of the Newton matrix at the next iteration.
+    void InvalidateJacobian() { jacobian_valid = false; }
+
     /// Return the number of iterations.
     int GetNumIterations() const { return numiters; }
 
@@ -246,6 +290,30 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
         archive >> CHNVP(abstolS);
         archive >> CHNVP(abstolL);
     }
+
+  protected:
+    /// Return true if the Newton matrix must be re-evaluated for a step of size h and the given problem size.
+    bool JacobianUpdateNeeded(double h, int nv, int nc) const {
+        return jacobian_max_age == 0 || !jacobian_valid || jacobian_age >= jacobian_max_age || h != jacobian_h ||
+               nv != jacobian_nv || nc != jacobian_nc;
+    }
+
+    /// Record an evaluation of the Newton matrix for a step of size h and the given problem size.
+    void JacobianUpdated(double h, int nv, int nc) {
+        jacobian_valid = true;
+        jacobian_age = 0;
+        jacobian_h = h;
+        jacobian_nv = nv;
+        jacobian_nc = nc;
+    }
+
+    /// Monitor the convergence rate of the Newton iteration, given the norm of the current update.
+    /// If the Newton matrix is reused across steps and the rate exceeds the threshold, the matrix is invalidated.
+    void MonitorConvergenceRate(int iteration, double nrm) {
+        if (jacobian_max_age > 0 && iteration > 0 && conv_nrm_prev > 0 && nrm / conv_nrm_prev > jacobian_max_rate)
+            jacobian_valid = false;
+        conv_nrm_prev = nrm;
+    }
 };
 
 /// Euler explicit timestepper.
@@ -353,6 +421,47 @@ class ChApi ChTimestepperLeapfrog : public ChTimestepperIIorder {
                          ) override;
 };
 
+/// Explicit central difference timestepper with lumped (diagonal) mass, for II order systems.
+/// The mass matrix is lumped by row sums, evaluated once in a matrix-free way as M*1 (and re-evaluated if the
+/// number of coordinates changes or after a call to ResetLumpedMass), so that accelerations are obtained
+/// from the applied and internal forces without calling the linear solver. This is the typical scheme for
+/// explicit dynamics of FEA meshes (e.g., impact simulations with ChElementTetra_4 or ChElementHexa_8).
+/// The method is conditionally stable: the requested step is subdivided into substeps not larger than the
+/// value set with SetMaxSubstep (see ChMesh::ComputeStableStepSize for an estimate of the critical step).
+/// Constraints (links, NSC contacts) are not supported; use SMC contact. Rotational inertias of rigid
+/// bodies are also lumped by row sums (exact only for bodies with diagonal inertia tensor).
+class ChApi ChTimestepperCentralDifference : public ChTimestepperIIorder {
+  protected:
+    ChVectorDynamic<> Md;  ///< lumped (diagonal) mass
+    ChVectorDynamic<> R;   ///< generalized forces
+    double max_substep;    ///< maximum substep size (0: no subdivision)
+    int num_substeps;      ///< number of substeps in the last step
+
+  public:
+    /// Constructors (default empty)
+    ChTimestepperCentralDifference(ChIntegrableIIorder* intgr = nullptr)
+        : ChTimestepperIIorder(intgr), max_substep(0), num_substeps(0) {}
+
+    virtual Type GetType() const override { return Type::CENTRAL_DIFFERENCE; }
+
+    /// Set the maximum substep size (default: 0, i.e. one substep per step).
+    /// For stability, this should be a fraction (e.g., 0.9) of the critical step size.
+    void SetMaxSubstep(double h) { max_substep = h; }
+
+    /// Get the maximum substep size.
+    double GetMaxSubstep() const { return max_substep; }
+
+    /// Return the number of substeps taken in the last step.
+    int GetNumSubsteps() const { return num_substeps; }
+
+    /// Force a re-evaluation of the lumped mass at the next step (e.g., after a change of nodal masses).
+    void ResetLumpedMass() { Md.resize(0); }
+
+    /// Performs an integration timestep
+    virtual void Advance(const double dt  ///< timestep to advance
+                         ) override;
+};
+
 /// Performs a step of Euler implicit for II order systems.
 class ChApi ChTimestepperEulerImplicit : public ChTimestepperIIorder, public ChImplicitIterativeTimestepper {
   protected:
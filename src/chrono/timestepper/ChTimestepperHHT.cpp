@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -34,6 +35,18 @@ ChTimestepperHHT::ChTimestepperHHT(ChIntegrableIIorder* intgr)
       h_min(1e-10),
       h(1e6),
       num_successful_steps(0),
+      error_control(false),
+      err_reltol(1e-3),
+      err_abstol(1e-6),
+      err_safety(0.9),
+      err_max_increase(5),
+      err_estimate(0),
+      err_prev(1),
+      event_step_factor(0.1),
+      event_pending(false),
+      num_accepted_steps(0),
+      num_rejected_steps(0),
+      num_failed_steps(0),
       modified_Newton(true) {
     SetAlpha(-0.2);  // default: some dissipation
 }
@@ -50,6 +63,7 @@ void ChTimestepperHHT::SetAlpha(double malpha) {
 
 // Performs a step of HHT (generalized alpha) implicit for II order systems
 void ChTimestepperHHT::Advance(const double dt) {
+    CH_PROFILE_ZONE("ChTimestepperHHT::Advance");
     // Downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -86,9 +100,19 @@ void ChTimestepperHHT::Advance(const double dt) {
     // If we had a streak of successful steps, consider a stepsize increase.
     // Note that we never attempt a step larger than the specified dt value.
     // If step size control is disabled, always use h = dt.
+    // If using error-based control, start from the step size proposed by the controller
+    // (limited after an event notification).
     if (!step_control) {
         h = dt;
         num_successful_steps = 0;
+    } else if (error_control) {
+        h = ChMin(h, dt);
+        if (event_pending) {
+            h = ChMin(h, event_step_factor * dt);
+            err_prev = 1;
+            if (verbose)
+                GetLog() << " ---HHT event, limit stepsize to " << h << "\n";
+        }
     } else if (num_successful_steps >= req_successful_steps) {
         double new_h = ChMin(h * step_increase_factor, dt);
         if (new_h > h + h_min) {
@@ -100,18 +124,36 @@ void ChTimestepperHHT::Advance(const double dt) {
     } else {
         h = ChMin(h, dt);
     }
+    event_pending = false;
 
     // Monitor flags controlling whther or not the Newton matrix must be updated.
     // If using modified Newton, a matrix update occurs:
-    //   - at the beginning of a step
-    //   - on a stepsize decrease
+    //   - at the beginning of a step (unless the matrix is reused across steps, see SetJacobianReuse)
+    //   - on a stepsize change
     //   - if the Newton iteration does not converge with an out-of-date matrix
+    //   - if the Newton convergence rate degrades (only if the matrix is reused across steps)
     // Otherwise, the matrix is updated at each iteration.
+    int nv = mintegrable->GetNcoords_v();
+    int nc = mintegrable->GetNconstr();
     matrix_is_current = false;
-    call_setup = true;
+    call_setup = JacobianUpdateNeeded(h, nv, nc);
 
     // Loop until reaching final time
     while (true) {
+        // With error control, the internal step size is arbitrary; do not step past the final time
+        // (and avoid leaving a very small last step). Keep the step size proposed by the controller,
+        // to be restored if the truncated step is accepted.
+        double h_proposed = 0;
+        if (error_control && step_control && T + 1.01 * h > tfinal) {
+            if (tfinal - T < h)
+                h_proposed = h;
+            h = tfinal - T;
+        }
+
+        // The Newton matrix depends on the step size
+        if (h != jacobian_h)
+            call_setup = true;
+
         double scaling_factor = scaling ? beta * h * h : 1;
         Prepare(mintegrable, scaling_factor);
 
@@ -133,17 +175,25 @@ void ChTimestepperHHT::Advance(const double dt) {
                 numsetups++;
             }
 
-            // If using modified Newton, do not call Setup again
-            call_setup = !modified_Newton;
-
             // Check convergence
-            converged = CheckConvergence(scaling_factor);
+            converged = CheckConvergence(it, scaling_factor);
+
+            // If using modified Newton, do not call Setup again (unless the convergence rate degraded)
+            call_setup = !modified_Newton || !jacobian_valid;
+
             if (converged)
                 break;
         }
 
-        if (converged) {
-            // ------ NR converged
+        // Estimate the local truncation error of a converged step
+        bool error_ok = true;
+        if (converged && error_control && step_control) {
+            err_estimate = EstimateLocalError();
+            error_ok = (err_estimate <= 1);
+        }
+
+        if (converged && error_ok) {
+            // ------ NR converged (and local error test passed)
 
             // if the number of iterations was low enough, increase the count of successive
             // successful steps (for possible step increase)
@@ -169,20 +219,56 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
-            /*
-            } else if (!matrix_is_current) {
-                // ------ NR did not converge but the matrix was out-of-date
+            num_accepted_steps++;
+
+            // Select the next step size with a PI controller (order 2 method, local error O(h^3)).
+            // The error of a step truncated to reach the final time is not representative: do not
+            // use it to update the controller and resume from the step size proposed before truncation.
+            if (h_proposed > 0) {
+                h = h_proposed;
+            } else if (error_control && step_control) {
+                double err = ChMax(err_estimate, 1e-6);
+                double factor = err_safety * std::pow(err, -0.7 / 3) * std::pow(err_prev, 0.4 / 3);
+                factor = ChMin(ChMax(factor, step_decrease_factor), err_max_increase);
+                err_prev = err;
+                h *= factor;
+                if (verbose)
+                    GetLog() << " HHT error estimate " << err_estimate << ", next stepsize " << h << "\n";
+            }
 
-                // reset the count of successive successful steps
-                num_successful_steps = 0;
+        } else if (!converged && jacobian_max_age > 0 && !matrix_is_current) {
+            // ------ NR did not converge but the matrix was out-of-date (reused from a previous step)
+
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
+
+            // re-attempt step with updated matrix
+            if (verbose) {
+                GetLog() << " HHT re-attempt step with updated matrix.\n";
+            }
+
+            call_setup = true;
 
-                // re-attempt step with updated matrix
-                if (verbose) {
-                    GetLog() << " HHT re-attempt step with updated matrix.\n";
-                }
+        } else if (converged) {
+            // ------ NR converged, but the local error estimate is too large
 
-                call_setup = true;
-            */
+            num_rejected_steps++;
+
+            // reduce stepsize based on the error estimate and repeat the step
+            h *= ChMax(step_decrease_factor, err_safety * std::pow(err_estimate, -1.0 / 3));
+
+            if (verbose)
+                GetLog() << " ---HHT error test failed (" << err_estimate << "), reduce stepsize to " << h << "\n";
+
+            // bail out if stepsize reaches minimum allowable
+            if (h < h_min) {
+                if (verbose)
+                    GetLog() << " HHT at minimum stepsize. Exiting...\n";
+                throw ChException("HHT: Reached minimum allowable step size.");
+            }
+
+            // force a matrix re-evaluation (due to change in stepsize)
+            call_setup = true;
 
         } else if (!step_control) {
             // ------ NR did not converge and we do not control stepsize
@@ -202,11 +288,17 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
+            num_failed_steps++;
+            InvalidateJacobian();
+
         } else {
             // ------ NR did not converge
 
+            num_failed_steps++;
+
             // reset the count of successive successful steps
             num_successful_steps = 0;
+            err_prev = 1;
 
             // decrease stepsize
             h *= step_decrease_factor;
@@ -225,6 +317,9 @@ void ChTimestepperHHT::Advance(const double dt) {
             call_setup = true;
         }
 
+        // The matrix used in the next attempt is evaluated in that attempt only if call_setup is set
+        matrix_is_current = matrix_is_current && !call_setup;
+
         if (T >= tfinal) {
             break;
         }
@@ -236,6 +331,8 @@ void ChTimestepperHHT::Advance(const double dt) {
         Anew.setZero(mintegrable->GetNcoords_a(), mintegrable);
     }
 
+    jacobian_age++;
+
     // Scatter state -> system doing a full update
     mintegrable->StateScatter(X, V, T, true);
 
@@ -357,11 +454,14 @@ void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable, double scaling
     }
 
     // If Setup was called at this iteration, mark the Newton matrix as up-to-date
-    matrix_is_current = call_setup;
+    if (call_setup) {
+        matrix_is_current = true;
+        JacobianUpdated(h, (int)R.size(), (int)Qc.size());
+    }
 }
 
 // Convergence test
-bool ChTimestepperHHT::CheckConvergence(double scaling_factor) {
+bool ChTimestepperHHT::CheckConvergence(int iteration, double scaling_factor) {
     bool converged = false;
 
     switch (mode) {
@@ -385,6 +485,8 @@ bool ChTimestepperHHT::CheckConvergence(double scaling_factor) {
             if ((R_nrm < abstolS && Qc_nrm < abstolL) || (Da_nrm < 1 && Dl_nrm < 1))
                 converged = true;
 
+            MonitorConvergenceRate(iteration, ChMax(Da_nrm, Dl_nrm));
+
             break;
         }
         case POSITION: {
@@ -405,6 +507,8 @@ bool ChTimestepperHHT::CheckConvergence(double scaling_factor) {
             if (Dx_nrm < 1 && Dl_nrm < 1)
                 converged = true;
 
+            MonitorConvergenceRate(iteration, ChMax(Dx_nrm, Dl_nrm));
+
             break;
         }
     }
@@ -412,6 +516,17 @@ bool ChTimestepperHHT::CheckConvergence(double scaling_factor) {
     return converged;
 }
 
+// Estimate the local truncation error of the position update over the last step, using the
+// a-posteriori estimator of Zienkiewicz and Xie for Newmark-type methods:
+//    e = h^2 * (beta - 1/6) * (a_new - a_old)
+// The estimate is measured in a WRMS norm with weights relative to the position increment over the step
+// (approximated as 0.5 * h * (v_old + v_new)), so that a value below 1 indicates an acceptable step.
+double ChTimestepperHHT::EstimateLocalError() {
+    ChVectorDynamic<> err = (h * h * std::abs(beta - 1.0 / 6)) * (Anew - A);
+    ChVectorDynamic<> ewt = (err_reltol * (0.5 * h) * (V + Vnew).cwiseAbs()).array() + err_abstol;
+    return err.wrmsNorm(ewt.cwiseInverse());
+}
+
 // Calculate the error weight vector corresponding to the specified solution vector x,
 // using the given relative and absolute tolerances.
 void ChTimestepperHHT::CalcErrorWeights(const ChVectorDynamic<>& x, double rtol, double atol, ChVectorDynamic<>& ewt) {
@@ -25,6 +25,8 @@ namespace chrono {
 /// Implementation of the HHT implicit integrator for II order systems.
 /// This timestepper allows use of an adaptive time-step, as well as optional use of a modified
 /// Newton scheme for the solution of the resulting nonlinear problem.
+/// The internal step size can be controlled based on the Newton convergence rate (default) or,
+/// optionally, on an estimate of the local truncation error using a PI step size controller.
 class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIterativeTimestepper {
 
   public:
@@ -61,6 +63,20 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     double h;                     ///< internal stepsize
     int num_successful_steps;     ///< number of successful steps
 
+    bool error_control;        ///< step size control based on local error estimate enabled?
+    double err_reltol;         ///< relative tolerance for the local error estimate
+    double err_abstol;         ///< absolute tolerance for the local error estimate
+    double err_safety;         ///< safety factor for the step size controller (<1)
+    double err_max_increase;   ///< maximum step size increase factor from one step to the next
+    double err_estimate;       ///< local error estimate (WRMS norm) of the last converged step
+    double err_prev;           ///< local error estimate of the last accepted step (PI controller)
+    double event_step_factor;  ///< step size reduction factor (relative to dt) after an event
+    bool event_pending;        ///< was an event notified since the last step?
+
+    int num_accepted_steps;  ///< total number of accepted internal steps
+    int num_rejected_steps;  ///< total number of internal steps rejected by the error test
+    int num_failed_steps;    ///< total number of internal steps with Newton convergence failure
+
     bool modified_Newton;    ///< use modified Newton?
     bool matrix_is_current;  ///< is the Newton matrix up-to-date?
     bool call_setup;         ///< should the solver's Setup function be called?
@@ -111,9 +127,69 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// Must be a value smaller than 1.
     void SetStepDecreaseFactor(double factor) { step_decrease_factor = factor; }
 
+    /// Enable/disable step size control based on an estimate of the local truncation error.
+    /// If enabled, the internal step size is selected by a PI controller so that the WRMS norm of the
+    /// estimated local position error, weighted with the given tolerances relative to the position
+    /// increment over the step, stays below 1. Steps with larger error are rejected and repeated.
+    /// This replaces the default step size increase based on Newton convergence; a Newton failure still
+    /// triggers a step size decrease. Error control is disabled by default and requires step control.
+    /// Note that, when used with a ChSystem, collision detection is performed only once per call to Advance:
+    /// all internal steps within the requested step dt use the contact set found at its beginning, and
+    /// contacts created within dt are only seen (and notified as events) at the next call. For problems with
+    /// contact, use GetStepSize() to select the next requested step, e.g. DoStepDynamics(min(dt, GetStepSize())).
+    void SetErrorControl(bool val, double reltol = 1e-3, double abstol = 1e-6) {
+        error_control = val;
+        err_reltol = reltol;
+        err_abstol = abstol;
+    }
+
+    /// Set the safety factor (<1) and maximum step increase factor (>1) used by the error-based controller.
+    void SetErrorControlFactors(double safety, double max_increase) {
+        err_safety = safety;
+        err_max_increase = max_increase;
+    }
+
+    /// Set the factor (relative to the requested step) used to limit the first internal step
+    /// following an event notification (default: 0.1).
+    void SetEventStepFactor(double factor) { event_step_factor = factor; }
+
+    /// Notify the integrator of a discontinuity (e.g., contact onset) at the current time.
+    /// If error control is enabled, the next internal step is limited to a fraction of the requested step
+    /// size, and the controller history is reset. This function is called by ChSystem when a new pair of
+    /// contactable objects comes into contact.
+    void NotifyEvent() { event_pending = true; }
+
+    /// Return true if step size control based on the local error estimate is active.
+    bool GetErrorControl() const { return error_control && step_control; }
+
+    /// Return the current internal step size.
+    /// With error control, this is the step size proposed by the controller for the next internal step
+    /// (not truncated to reach the end of the last requested step).
+    double GetStepSize() const { return h; }
+
+    /// Return the local error estimate (WRMS norm) of the last converged internal step.
+    double GetErrorEstimate() const { return err_estimate; }
+
+    /// Return the total number of accepted internal steps.
+    int GetNumAcceptedSteps() const { return num_accepted_steps; }
+
+    /// Return the total number of internal steps rejected by the local error test.
+    int GetNumRejectedSteps() const { return num_rejected_steps; }
+
+    /// Return the total number of internal steps for which the Newton iteration failed to converge.
+    int GetNumFailedSteps() const { return num_failed_steps; }
+
+    /// Reset the accepted/rejected/failed step counters.
+    void ResetStepStatistics() {
+        num_accepted_steps = 0;
+        num_rejected_steps = 0;
+        num_failed_steps = 0;
+    }
+
     /// Enable/disable modified Newton.
     /// If enabled, the Newton matrix is evaluated, assembled, and factorized only once
     /// per step or if the Newton iteration does not converge with an out-of-date matrix.
+    /// See SetJacobianReuse for keeping the matrix across several steps.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
     /// Modified Newton iteration is enabled by default.
     void SetModifiedNewton(bool val) { modified_Newton = val; }
@@ -131,7 +207,8 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
   private:
     void Prepare(ChIntegrableIIorder* integrable, double scaling_factor);
     void Increment(ChIntegrableIIorder* integrable, double scaling_factor);
-    bool CheckConvergence(double scaling_factor);
+    bool CheckConvergence(int iteration, double scaling_factor);
+    double EstimateLocalError();
     void CalcErrorWeights(const ChVectorDynamic<>& x, double rtol, double atol, ChVectorDynamic<>& ewt);
 };
 
@@ -43,7 +43,7 @@ namespace utils {
 
 #ifndef CH_NO_PROFILE
 
-static ChTimer<double> gProfileClock;
+static thread_local ChTimer<double> gProfileClock;
 
 #define mymin(a,b) (a > b ? a : b)
 
@@ -230,10 +230,34 @@ void	ChProfileIterator::Enter_Parent( void )
 **
 ***************************************************************************************************/
 
-ChProfileNode	ChProfileManager::Root( "Root", NULL );
-ChProfileNode *	ChProfileManager::CurrentNode = &ChProfileManager::Root;
-int				ChProfileManager::FrameCounter = 0;
-unsigned long int			ChProfileManager::ResetTime = 0;
+// Profile tree and counters of one thread
+struct ChProfileState {
+	ChProfileNode Root{ "Root", NULL };
+	ChProfileNode* CurrentNode = &Root;
+	int FrameCounter = 0;
+	unsigned long int ResetTime = 0;
+};
+
+static ChProfileState& GetProfileState()
+{
+	static thread_local ChProfileState state;
+	return state;
+}
+
+void ChProfileManager::CleanupMemory(void)
+{
+	GetProfileState().Root.CleanupMemory();
+}
+
+int ChProfileManager::Get_Frame_Count_Since_Reset(void)
+{
+	return GetProfileState().FrameCounter;
+}
+
+ChProfileIterator* ChProfileManager::Get_Iterator(void)
+{
+	return new ChProfileIterator(&GetProfileState().Root);
+}
 
 
 /***********************************************************************************************
@@ -251,6 +275,7 @@ unsigned long int			ChProfileManager::ResetTime = 0;
  *=============================================================================================*/
 void	ChProfileManager::Start_Profile( const char * name )
 {
+	ChProfileNode*& CurrentNode = GetProfileState().CurrentNode;
 	if (name != CurrentNode->Get_Name()) {
 		CurrentNode = CurrentNode->Get_Sub_Node( name );
 	} 
@@ -266,6 +291,7 @@ void	ChProfileManager::Stop_Profile( void )
 {
 	// Return will indicate whether we should back up to our parent (we may
 	// be profiling a recursive function)
+	ChProfileNode*& CurrentNode = GetProfileState().CurrentNode;
 	if (CurrentNode->Return()) {
 		CurrentNode = CurrentNode->Get_Parent();
 	}
@@ -281,10 +307,11 @@ void	ChProfileManager::Reset( void )
 { 
 	gProfileClock.reset();
     gProfileClock.start();
-	Root.Reset();
-    Root.Call();
-	FrameCounter = 0;
-	Profile_Get_Ticks(&ResetTime);
+	ChProfileState& state = GetProfileState();
+	state.Root.Reset();
+	state.Root.Call();
+	state.FrameCounter = 0;
+	Profile_Get_Ticks(&state.ResetTime);
 }
 
 
@@ -293,7 +320,7 @@ void	ChProfileManager::Reset( void )
  *=============================================================================================*/
 void ChProfileManager::Increment_Frame_Counter( void )
 {
-	FrameCounter++;
+	GetProfileState().FrameCounter++;
 }
 
 
@@ -304,7 +331,7 @@ float ChProfileManager::Get_Time_Since_Reset( void )
 {
 	unsigned long int time;
 	Profile_Get_Ticks(&time);
-	time -= ResetTime;
+	time -= GetProfileState().ResetTime;
 	return (float)time / Profile_Get_Tick_Rate();
 }
 
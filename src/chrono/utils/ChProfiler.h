@@ -46,6 +46,7 @@ CODE MODIFIED FROM:
 #include <ratio>
 #include <chrono>
 #include "chrono/core/ChApiCE.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 namespace utils {
@@ -127,32 +128,23 @@ public:
 	static	void						Start_Profile( const char * name );
 	static	void						Stop_Profile( void );
 
-	static	void						CleanupMemory(void)
-	{
-		Root.CleanupMemory();
-	}
+	static	void						CleanupMemory(void);
 
 	static	void						Reset( void );
 	static	void						Increment_Frame_Counter( void );
-	static	int						Get_Frame_Count_Since_Reset( void )		{ return FrameCounter; }
+	static	int						Get_Frame_Count_Since_Reset( void );
 	static	float						Get_Time_Since_Reset( void );
 
-	static	ChProfileIterator *	Get_Iterator( void )	
-	{ 
-		
-		return new ChProfileIterator( &Root ); 
-	}
+	static	ChProfileIterator *	Get_Iterator( void );
 	static	void						Release_Iterator( ChProfileIterator * iterator ) { delete ( iterator); }
 
 	static void	dumpRecursive(ChProfileIterator* profileIterator, int spacing);
 
 	static void	dumpAll();
 
-private:
-	static	ChProfileNode			Root;
-	static	ChProfileNode *			CurrentNode;
-	static	int						FrameCounter;
-	static	unsigned long int					ResetTime;
+	// Each thread records into its own profile tree, so that independent systems can be
+	// simulated concurrently (e.g. in a ChVehicleFleet). All functions of the manager,
+	// including the iterator and the dump functions, refer to the tree of the calling thread.
 };
 
 
@@ -177,10 +169,12 @@ public:
 }  // end namespace chrono
 
 
-#define	CH_PROFILE( name )			chrono::utils::CProfileSample __ch_profile( name )
+#define	CH_PROFILE( name )			chrono::utils::CProfileSample __ch_profile( name ); CH_PROFILE_ZONE( name )
 
 #else
 
+#include "chrono/utils/ChTraceProfiler.h"
+
 #define	CH_PROFILE( name )
 
 #endif //#ifndef CH_NO_PROFILE
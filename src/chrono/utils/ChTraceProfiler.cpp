@@ -0,0 +1,193 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "chrono/utils/ChTraceProfiler.h"
+
+namespace chrono {
+namespace utils {
+
+namespace {
+
+// Zones recorded by one thread. Only the owner thread writes to it.
+struct ThreadTrace {
+    unsigned int id;
+    std::string name;
+    int depth = 0;
+    std::vector<ChTraceProfiler::Event> events;
+};
+
+// Buffers of all threads that ever recorded a zone. They are owned here (not by the
+// threads), so that the zones of terminated threads are still available for export.
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadTrace>> threads;
+    std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+ThreadTrace& GetThreadTrace() {
+    thread_local ThreadTrace* trace = nullptr;
+    if (!trace) {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.threads.emplace_back(new ThreadTrace);
+        trace = registry.threads.back().get();
+        trace->id = (unsigned int)(registry.threads.size() - 1);
+        trace->name = "thread " + std::to_string(trace->id);
+    }
+    return *trace;
+}
+
+void WriteEscaped(std::ostream& os, const std::string& str) {
+    for (char c : str) {
+        if (c == '"' || c == '\\')
+            os << '\\';
+        os << c;
+    }
+}
+
+// Events of one thread, ordered by start time (enclosing zones first).
+std::vector<ChTraceProfiler::Event> SortedEvents(const ThreadTrace& trace) {
+    std::vector<ChTraceProfiler::Event> events = trace.events;
+    std::sort(events.begin(), events.end(), [](const ChTraceProfiler::Event& a, const ChTraceProfiler::Event& b) {
+        return a.start < b.start || (a.start == b.start && a.depth < b.depth);
+    });
+    return events;
+}
+
+}  // end namespace
+
+std::atomic<bool> ChTraceProfiler::m_enabled(false);
+
+int64_t ChTraceProfiler::Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                GetRegistry().epoch)
+        .count();
+}
+
+void ChTraceProfiler::Enable(bool val) {
+    m_enabled.store(val, std::memory_order_relaxed);
+}
+
+void ChTraceProfiler::Reset() {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& trace : registry.threads)
+        trace->events.clear();
+    registry.epoch = std::chrono::steady_clock::now();
+}
+
+void ChTraceProfiler::SetThreadName(const std::string& name) {
+    GetThreadTrace().name = name;
+}
+
+size_t ChTraceProfiler::GetNumEvents() {
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    size_t num_events = 0;
+    for (auto& trace : registry.threads)
+        num_events += trace->events.size();
+    return num_events;
+}
+
+void ChTraceProfiler::BeginZone(int64_t& start) {
+    GetThreadTrace().depth++;
+    start = Now();
+}
+
+void ChTraceProfiler::EndZone(const char* name, int64_t start) {
+    int64_t end = Now();
+    ThreadTrace& trace = GetThreadTrace();
+    trace.depth--;
+    trace.events.push_back({name, start, end, trace.depth});
+}
+
+bool ChTraceProfiler::WriteChromeTrace(const std::string& filename) {
+    std::ofstream os(filename);
+    if (!os.good())
+        return false;
+
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    char buf[64];
+    bool first = true;
+    os << "{\"traceEvents\":[\n";
+    for (auto& trace : registry.threads) {
+        os << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << trace->id
+           << ",\"args\":{\"name\":\"";
+        WriteEscaped(os, trace->name);
+        os << "\"}}";
+        first = false;
+        for (auto& e : SortedEvents(*trace)) {
+            // Timestamps and durations in microseconds
+            snprintf(buf, sizeof(buf), "\"ts\":%.3f,\"dur\":%.3f", e.start * 1e-3, (e.end - e.start) * 1e-3);
+            os << ",\n{\"name\":\"";
+            WriteEscaped(os, e.name);
+            os << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << trace->id << "," << buf << "}";
+        }
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return os.good();
+}
+
+bool ChTraceProfiler::WriteFoldedStacks(const std::string& filename) {
+    std::ofstream os(filename);
+    if (!os.good())
+        return false;
+
+    Registry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    // Self time (ns) of each call path, summed over all threads
+    std::map<std::string, int64_t> self_times;
+    for (auto& trace : registry.threads) {
+        std::vector<ChTraceProfiler::Event> events = SortedEvents(*trace);
+        std::vector<std::pair<std::string, int64_t*>> stack;  // enclosing call paths and their self times
+        for (auto& e : events) {
+            while ((int)stack.size() > e.depth)
+                stack.pop_back();
+            std::string path = stack.empty() ? std::string(e.name) : stack.back().first + ";" + e.name;
+            int64_t duration = e.end - e.start;
+            if (!stack.empty())
+                *stack.back().second -= duration;
+            int64_t* self_time = &self_times[path];
+            *self_time += duration;
+            stack.emplace_back(path, self_time);
+        }
+    }
+
+    for (auto& entry : self_times) {
+        long long self_time = (entry.second + 500) / 1000;
+        if (self_time > 0)
+            os << entry.first << " " << self_time << "\n";
+    }
+
+    return os.good();
+}
+
+}  // end namespace utils
+}  // end namespace chrono
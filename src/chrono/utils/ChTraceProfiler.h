@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Thread-aware scoped profiling zones, with export to the Chrome trace event
+// format (chrome://tracing, Perfetto, speedscope) and to folded stacks for
+// flame graph tools.
+//
+// Each thread records its zones in its own buffer, so zones can be used inside
+// parallel regions without locking. A thread takes a lock only once, the first
+// time it records a zone, to register its buffer. When recording is disabled,
+// a zone costs a single relaxed atomic load.
+//
+// =============================================================================
+
+#ifndef CHTRACEPROFILER_H
+#define CHTRACEPROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Recorder of profiling zones, with per-thread buffers.
+/// Recording is disabled by default. Reset() and the export functions must be called
+/// while no thread is recording, e.g. between simulation steps.
+class ChApi ChTraceProfiler {
+  public:
+    /// A completed zone; times in nanoseconds since the last Reset().
+    struct Event {
+        const char* name;  ///< zone name (static string)
+        int64_t start;     ///< start time
+        int64_t end;       ///< end time
+        int depth;         ///< nesting level of the zone in its thread (0: top level)
+    };
+
+    /// Enable or disable recording of profiling zones.
+    static void Enable(bool val);
+
+    /// Return true if profiling zones are being recorded.
+    static bool IsEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+
+    /// Discard all recorded zones and restart the clock.
+    static void Reset();
+
+    /// Set the name displayed for the calling thread in the exported trace.
+    static void SetThreadName(const std::string& name);
+
+    /// Return the total number of recorded zones, over all threads.
+    static size_t GetNumEvents();
+
+    /// Write the recorded zones in the Chrome trace event format (JSON).
+    /// Returns false if the file cannot be written.
+    static bool WriteChromeTrace(const std::string& filename);
+
+    /// Write the recorded zones as folded stacks ("zone;child;grandchild self_time"),
+    /// one line per call path, with self times in microseconds summed over all threads.
+    /// This is the input format of flame graph tools (e.g. flamegraph.pl, speedscope).
+    /// Returns false if the file cannot be written.
+    static bool WriteFoldedStacks(const std::string& filename);
+
+  private:
+    static int64_t Now();
+    static void BeginZone(int64_t& start);
+    static void EndZone(const char* name, int64_t start);
+
+    static std::atomic<bool> m_enabled;
+
+    friend class ChProfileZone;
+};
+
+/// Scoped profiling zone: records the time spent between its construction and its
+/// destruction. The name must be a string with static storage duration (e.g. a literal).
+/// Use through the CH_PROFILE_ZONE macro.
+class ChApi ChProfileZone {
+  public:
+    explicit ChProfileZone(const char* name) : m_name(nullptr) {
+        if (ChTraceProfiler::IsEnabled()) {
+            m_name = name;
+            ChTraceProfiler::BeginZone(m_start);
+        }
+    }
+
+    ~ChProfileZone() {
+        if (m_name)
+            ChTraceProfiler::EndZone(m_name, m_start);
+    }
+
+  private:
+    ChProfileZone(const ChProfileZone&) = delete;
+    ChProfileZone& operator=(const ChProfileZone&) = delete;
+
+    const char* m_name;
+    int64_t m_start;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#define CH_PROFILE_ZONE_CONCAT_(a, b) a##b
+#define CH_PROFILE_ZONE_CONCAT(a, b) CH_PROFILE_ZONE_CONCAT_(a, b)
+
+#ifndef CH_NO_PROFILE
+/// Record a profiling zone named 'name' for the rest of the enclosing scope.
+#define CH_PROFILE_ZONE(name) \
+    chrono::utils::ChProfileZone CH_PROFILE_ZONE_CONCAT(__ch_profile_zone, __LINE__)(name)
+#else
+#define CH_PROFILE_ZONE(name)
+#endif
+
+#endif
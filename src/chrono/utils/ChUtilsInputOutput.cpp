@@ -527,14 +527,14 @@ void WriteMeshPovray(geometry::ChTriangleMeshConnected& trimesh,
                      const ChVector<>& pos,
                      const ChQuaternion<>& rot,
                      bool smoothed) {
+    ChFrame<> frame(pos, rot);
+
     // Transform vertices.
-    for (unsigned int i = 0; i < trimesh.m_vertices.size(); i++)
-        trimesh.m_vertices[i] = pos + rot.Rotate(trimesh.m_vertices[i]);
+    frame.TransformPointsLocalToParent(trimesh.m_vertices, trimesh.m_vertices);
 
     // Transform normals
     if (smoothed) {
-        for (unsigned int i = 0; i < trimesh.m_normals.size(); i++)
-            trimesh.m_normals[i] = rot.Rotate(trimesh.m_normals[i]);
+        frame.TransformDirectionsLocalToParent(trimesh.m_normals, trimesh.m_normals);
     }
 
     // Open output file.
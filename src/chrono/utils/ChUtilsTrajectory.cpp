@@ -0,0 +1,403 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Columnar, chunked binary format for body trajectories.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "chrono/core/ChException.h"
+#include "chrono/utils/ChUtilsTrajectory.h"
+
+namespace chrono {
+namespace utils {
+
+static const char traj_magic[8] = {'C', 'H', 'T', 'R', 'A', 'J', '0', '1'};
+static const char traj_end_magic[8] = {'C', 'H', 'T', 'R', 'J', 'E', 'N', 'D'};
+static const uint32_t traj_version = 1;
+static const int traj_num_fields = 6;
+static const size_t traj_trailer_size = 3 * sizeof(uint64_t) + sizeof(traj_end_magic);
+
+static size_t HeaderSize(size_t num_bodies) {
+    size_t size = sizeof(traj_magic) + 4 * sizeof(uint32_t) + num_bodies * sizeof(int32_t);
+    return (size + 7) & ~size_t(7);
+}
+
+// -----------------------------------------------------------------------------
+// ChTrajectoryWriter
+// -----------------------------------------------------------------------------
+
+ChTrajectoryWriter::ChTrajectoryWriter(const std::string& filename, int fields, unsigned int chunk_frames)
+    : m_fields(fields & TRAJ_ALL),
+      m_chunk_frames(chunk_frames > 0 ? chunk_frames : 1),
+      m_interval(1),
+      m_step_counter(0),
+      m_closed(false),
+      m_num_frames(0) {
+    m_file.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open())
+        throw ChException("ChTrajectoryWriter: cannot open file " + filename);
+    m_column.resize(traj_num_fields);
+}
+
+ChTrajectoryWriter::~ChTrajectoryWriter() {
+    try {
+        Close();
+    } catch (const ChException&) {
+    }
+}
+
+void ChTrajectoryWriter::OnEndStep(ChSystem* system) {
+    if (m_step_counter++ % m_interval == 0)
+        WriteFrame(system);
+}
+
+void ChTrajectoryWriter::WriteHeader(ChSystem* system) {
+    m_bodies = system->Get_bodylist();
+
+    uint32_t header[4] = {traj_version, (uint32_t)m_fields, (uint32_t)m_bodies.size(), m_chunk_frames};
+    std::vector<int32_t> identifiers;
+    for (const auto& body : m_bodies)
+        identifiers.push_back(body->GetIdentifier());
+
+    m_file.write(traj_magic, sizeof(traj_magic));
+    m_file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    m_file.write(reinterpret_cast<const char*>(identifiers.data()), identifiers.size() * sizeof(int32_t));
+    size_t written = sizeof(traj_magic) + sizeof(header) + identifiers.size() * sizeof(int32_t);
+    size_t padding = HeaderSize(m_bodies.size()) - written;
+    const char zeros[8] = {0};
+    m_file.write(zeros, padding);
+
+    // Reserve the chunk buffers
+    size_t nb = m_bodies.size();
+    for (int f = 0; f < traj_num_fields; f++) {
+        auto field = static_cast<ChTrajectoryField>(1 << f);
+        if (m_fields & field)
+            m_column[f].reserve(m_chunk_frames * nb * ChTrajectoryReader::GetNumComponents(field));
+    }
+    m_time.reserve(m_chunk_frames);
+}
+
+void ChTrajectoryWriter::WriteFrame(ChSystem* system) {
+    if (m_closed)
+        throw ChException("ChTrajectoryWriter: cannot write to a closed trajectory file");
+
+    if (m_num_frames == 0)
+        WriteHeader(system);
+    else if (system->Get_bodylist() != m_bodies)
+        throw ChException("ChTrajectoryWriter: the set of bodies changed during recording");
+
+    m_time.push_back(system->GetChTime());
+
+    for (const auto& body : m_bodies) {
+        if (m_fields & TRAJ_POS) {
+            const auto& p = body->GetPos();
+            m_column[0].insert(m_column[0].end(), {p.x(), p.y(), p.z()});
+        }
+        if (m_fields & TRAJ_ROT) {
+            const auto& q = body->GetRot();
+            m_column[1].insert(m_column[1].end(), {q.e0(), q.e1(), q.e2(), q.e3()});
+        }
+        if (m_fields & TRAJ_LIN_VEL) {
+            const auto& v = body->GetPos_dt();
+            m_column[2].insert(m_column[2].end(), {v.x(), v.y(), v.z()});
+        }
+        if (m_fields & TRAJ_ANG_VEL) {
+            auto w = body->GetWvel_par();
+            m_column[3].insert(m_column[3].end(), {w.x(), w.y(), w.z()});
+        }
+        if (m_fields & TRAJ_CONTACT_FORCE) {
+            auto f = body->GetContactForce();
+            m_column[4].insert(m_column[4].end(), {f.x(), f.y(), f.z()});
+        }
+        if (m_fields & TRAJ_CONTACT_TORQUE) {
+            auto t = body->GetContactTorque();
+            m_column[5].insert(m_column[5].end(), {t.x(), t.y(), t.z()});
+        }
+    }
+
+    m_num_frames++;
+    if (m_time.size() == m_chunk_frames)
+        FlushChunk();
+}
+
+void ChTrajectoryWriter::FlushChunk() {
+    if (m_time.empty())
+        return;
+
+    m_chunk_offsets.push_back((uint64_t)m_file.tellp());
+
+    uint64_t n = m_time.size();
+    m_file.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    m_file.write(reinterpret_cast<const char*>(m_time.data()), m_time.size() * sizeof(double));
+    for (int f = 0; f < traj_num_fields; f++) {
+        if (m_fields & (1 << f)) {
+            m_file.write(reinterpret_cast<const char*>(m_column[f].data()), m_column[f].size() * sizeof(double));
+            m_column[f].clear();
+        }
+    }
+    m_time.clear();
+
+    if (!m_file.good())
+        throw ChException("ChTrajectoryWriter: error writing trajectory data");
+}
+
+void ChTrajectoryWriter::Close() {
+    if (m_closed)
+        return;
+    m_closed = true;
+
+    // Nothing was recorded; still produce a valid (empty) file
+    if (m_num_frames == 0) {
+        uint32_t header[4] = {traj_version, (uint32_t)m_fields, 0, m_chunk_frames};
+        m_file.write(traj_magic, sizeof(traj_magic));
+        m_file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    }
+
+    FlushChunk();
+
+    uint64_t index_offset = (uint64_t)m_file.tellp();
+    m_file.write(reinterpret_cast<const char*>(m_chunk_offsets.data()), m_chunk_offsets.size() * sizeof(uint64_t));
+
+    uint64_t trailer[3] = {m_num_frames, m_chunk_offsets.size(), index_offset};
+    m_file.write(reinterpret_cast<const char*>(trailer), sizeof(trailer));
+    m_file.write(traj_end_magic, sizeof(traj_end_magic));
+    m_file.close();
+
+    if (m_file.fail())
+        throw ChException("ChTrajectoryWriter: error finalizing trajectory file");
+}
+
+// -----------------------------------------------------------------------------
+// ChTrajectoryReader
+// -----------------------------------------------------------------------------
+
+ChTrajectoryReader::ChTrajectoryReader(const std::string& filename) : m_data(nullptr), m_size(0) {
+#ifdef _WIN32
+    m_map_handle = nullptr;
+    m_file_handle = INVALID_HANDLE_VALUE;
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        throw ChException("ChTrajectoryReader: cannot open file " + filename);
+    m_file_handle = file;
+    LARGE_INTEGER size;
+    GetFileSizeEx(file, &size);
+    m_size = (size_t)size.QuadPart;
+    if (m_size > 0) {
+        m_map_handle = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (m_map_handle)
+            m_data = static_cast<const char*>(MapViewOfFile(m_map_handle, FILE_MAP_READ, 0, 0, 0));
+    }
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw ChException("ChTrajectoryReader: cannot open file " + filename);
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        m_size = (size_t)st.st_size;
+        void* addr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED)
+            m_data = static_cast<const char*>(addr);
+    }
+    close(fd);
+#endif
+
+    size_t min_size = sizeof(traj_magic) + 4 * sizeof(uint32_t) + traj_trailer_size;
+    if (!m_data || m_size < min_size || std::memcmp(m_data, traj_magic, sizeof(traj_magic)) != 0 ||
+        std::memcmp(m_data + m_size - sizeof(traj_end_magic), traj_end_magic, sizeof(traj_end_magic)) != 0) {
+        Unmap();
+        throw ChException("ChTrajectoryReader: invalid or incomplete trajectory file " + filename);
+    }
+
+    uint32_t header[4];
+    std::memcpy(header, m_data + sizeof(traj_magic), sizeof(header));
+    if (header[0] != traj_version) {
+        Unmap();
+        throw ChException("ChTrajectoryReader: unsupported trajectory file version");
+    }
+    m_fields = (int)header[1];
+    m_chunk_frames = header[3];
+
+    // Validate all sizes and offsets read from the file against the mapped size before using them
+    uint64_t data_end = m_size - traj_trailer_size;
+    uint64_t num_bodies = header[2];
+    if (m_chunk_frames == 0 || (m_fields & ~TRAJ_ALL) != 0 || num_bodies > data_end / sizeof(int32_t) ||
+        HeaderSize((size_t)num_bodies) > data_end) {
+        Unmap();
+        throw ChException("ChTrajectoryReader: corrupt header in trajectory file " + filename);
+    }
+    m_identifiers.resize((size_t)num_bodies);
+    std::memcpy(m_identifiers.data(), m_data + sizeof(traj_magic) + sizeof(header),
+                m_identifiers.size() * sizeof(int32_t));
+
+    uint64_t trailer[3];
+    std::memcpy(trailer, m_data + data_end, sizeof(trailer));
+    uint64_t num_frames = trailer[0];
+    uint64_t num_chunks = trailer[1];
+    uint64_t index_offset = trailer[2];
+    if (index_offset < HeaderSize((size_t)num_bodies) || index_offset > data_end ||
+        num_chunks > (data_end - index_offset) / sizeof(uint64_t) ||
+        num_chunks != (num_frames + m_chunk_frames - 1) / m_chunk_frames) {
+        Unmap();
+        throw ChException("ChTrajectoryReader: corrupt chunk index in trajectory file " + filename);
+    }
+    m_num_frames = (size_t)num_frames;
+    m_chunk_offsets.resize((size_t)num_chunks);
+    std::memcpy(m_chunk_offsets.data(), m_data + index_offset, m_chunk_offsets.size() * sizeof(uint64_t));
+
+    // Number of values per frame (time and all recorded fields for all bodies)
+    uint64_t frame_values = 1;
+    for (int f = 0; f < traj_num_fields; f++) {
+        auto field = static_cast<ChTrajectoryField>(1 << f);
+        if (m_fields & field)
+            frame_values += num_bodies * GetNumComponents(field);
+    }
+
+    // Each chunk must lie between the header and the index, and hold the expected number of frames
+    for (size_t i = 0; i < m_chunk_offsets.size(); i++) {
+        uint64_t offset = m_chunk_offsets[i];
+        uint64_t expected = (i + 1 < m_chunk_offsets.size()) ? m_chunk_frames : num_frames - i * m_chunk_frames;
+        uint64_t n = 0;
+        bool valid = offset % sizeof(uint64_t) == 0 && offset >= HeaderSize((size_t)num_bodies) &&
+                     offset <= index_offset - sizeof(uint64_t);
+        if (valid)
+            std::memcpy(&n, m_data + offset, sizeof(n));
+        uint64_t available = (index_offset - offset - sizeof(uint64_t)) / sizeof(double);
+        valid = valid && n == expected && frame_values * n <= available;
+        if (!valid) {
+            Unmap();
+            throw ChException("ChTrajectoryReader: corrupt data chunk in trajectory file " + filename);
+        }
+    }
+}
+
+ChTrajectoryReader::~ChTrajectoryReader() {
+    Unmap();
+}
+
+void ChTrajectoryReader::Unmap() {
+#ifdef _WIN32
+    if (m_data)
+        UnmapViewOfFile(m_data);
+    if (m_map_handle)
+        CloseHandle(m_map_handle);
+    if (m_file_handle != INVALID_HANDLE_VALUE)
+        CloseHandle(m_file_handle);
+    m_map_handle = nullptr;
+    m_file_handle = INVALID_HANDLE_VALUE;
+#else
+    if (m_data)
+        munmap(const_cast<char*>(m_data), m_size);
+#endif
+    m_data = nullptr;
+}
+
+int ChTrajectoryReader::FindBody(int identifier) const {
+    auto it = std::find(m_identifiers.begin(), m_identifiers.end(), identifier);
+    return (it == m_identifiers.end()) ? -1 : (int)(it - m_identifiers.begin());
+}
+
+const char* ChTrajectoryReader::GetChunk(size_t frame, size_t& local_frame, size_t& chunk_frames) const {
+    if (frame >= m_num_frames)
+        throw ChException("ChTrajectoryReader: frame index out of range");
+
+    // All chunks, except possibly the last one, contain exactly m_chunk_frames frames
+    size_t chunk = frame / m_chunk_frames;
+    local_frame = frame - chunk * m_chunk_frames;
+    const char* data = m_data + m_chunk_offsets[chunk];
+    uint64_t n;
+    std::memcpy(&n, data, sizeof(n));
+    chunk_frames = (size_t)n;
+    return data + sizeof(uint64_t);
+}
+
+double ChTrajectoryReader::GetTime(size_t frame) const {
+    size_t local_frame, chunk_frames;
+    auto times = reinterpret_cast<const double*>(GetChunk(frame, local_frame, chunk_frames));
+    return times[local_frame];
+}
+
+size_t ChTrajectoryReader::FindFrame(double time) const {
+    if (m_num_frames == 0 || time <= GetTime(0))
+        return 0;
+
+    // Binary search over chunks (using their first frame), then within the selected chunk
+    size_t lo = 0;
+    size_t hi = m_chunk_offsets.size();
+    while (hi - lo > 1) {
+        size_t mid = (lo + hi) / 2;
+        if (GetTime(mid * m_chunk_frames) <= time)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    size_t local_frame, chunk_frames;
+    auto times = reinterpret_cast<const double*>(GetChunk(lo * m_chunk_frames, local_frame, chunk_frames));
+    auto it = std::upper_bound(times, times + chunk_frames, time);
+    return lo * m_chunk_frames + (size_t)(it - times) - 1;
+}
+
+const double* ChTrajectoryReader::GetFrameData(ChTrajectoryField field, size_t frame) const {
+    if (!HasField(field))
+        return nullptr;
+
+    size_t local_frame, chunk_frames;
+    auto column = reinterpret_cast<const double*>(GetChunk(frame, local_frame, chunk_frames));
+    column += chunk_frames;  // skip frame times
+
+    size_t nb = m_identifiers.size();
+    for (int f = 0; f < traj_num_fields; f++) {
+        auto current = static_cast<ChTrajectoryField>(1 << f);
+        if (current == field)
+            break;
+        if (m_fields & current)
+            column += chunk_frames * nb * GetNumComponents(current);
+    }
+
+    return column + local_frame * nb * GetNumComponents(field);
+}
+
+ChVector<> ChTrajectoryReader::GetVector(ChTrajectoryField field, size_t frame, size_t body) const {
+    const double* data = GetFrameData(field, frame);
+    if (!data)
+        throw ChException("ChTrajectoryReader: requested field was not recorded");
+    if (body >= m_identifiers.size())
+        throw ChException("ChTrajectoryReader: body index out of range");
+    data += 3 * body;
+    return ChVector<>(data[0], data[1], data[2]);
+}
+
+ChQuaternion<> ChTrajectoryReader::GetRot(size_t frame, size_t body) const {
+    const double* data = GetFrameData(TRAJ_ROT, frame);
+    if (!data)
+        throw ChException("ChTrajectoryReader: requested field was not recorded");
+    if (body >= m_identifiers.size())
+        throw ChException("ChTrajectoryReader: body index out of range");
+    data += 4 * body;
+    return ChQuaternion<>(data[0], data[1], data[2], data[3]);
+}
+
+}  // namespace utils
+}  // namespace chrono
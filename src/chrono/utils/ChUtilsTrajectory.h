@@ -0,0 +1,180 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Columnar, chunked binary format for body trajectories.
+//
+// ChTrajectoryWriter
+//  records the states of all bodies in a ChSystem (time, position, orientation,
+//  velocities, contact forces and torques). It can be registered with the system
+//  as an end-of-step callback or explicitly invoked by the user.
+//
+// ChTrajectoryReader
+//  provides random access (by frame and by body) to a trajectory file, through
+//  a read-only memory mapping of the file.
+//
+// File layout (all values in native byte order):
+//    header:  magic[8], version (u32), fields (u32), num_bodies (u32), chunk_frames (u32),
+//             body identifiers (i32 x num_bodies), padding to an 8-byte boundary
+//    chunks:  num_frames (u64), time (f64 x num_frames), and, for each recorded field,
+//             a column of f64 values laid out as [frame][body][component]
+//    index:   chunk offsets (u64 x num_chunks)
+//    trailer: num_frames (u64), num_chunks (u64), index offset (u64), end magic[8]
+//
+// =============================================================================
+
+#ifndef CH_UTILS_TRAJECTORY_H
+#define CH_UTILS_TRAJECTORY_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Quantities that can be recorded in a trajectory file.
+/// Values can be combined (bitwise OR) to select the recorded fields.
+enum ChTrajectoryField {
+    TRAJ_POS = 1 << 0,             ///< body reference frame position (3 values)
+    TRAJ_ROT = 1 << 1,             ///< body reference frame orientation quaternion (4 values)
+    TRAJ_LIN_VEL = 1 << 2,         ///< linear velocity, absolute frame (3 values)
+    TRAJ_ANG_VEL = 1 << 3,         ///< angular velocity, absolute frame (3 values)
+    TRAJ_CONTACT_FORCE = 1 << 4,   ///< resultant contact force, absolute frame (3 values)
+    TRAJ_CONTACT_TORQUE = 1 << 5,  ///< resultant contact torque, absolute frame (3 values)
+    TRAJ_STATE = TRAJ_POS | TRAJ_ROT | TRAJ_LIN_VEL | TRAJ_ANG_VEL,
+    TRAJ_ALL = TRAJ_STATE | TRAJ_CONTACT_FORCE | TRAJ_CONTACT_TORQUE
+};
+
+/// Writer for body trajectories in a columnar, chunked binary format.
+/// The set of bodies is captured at the first recorded frame and must not change afterwards.
+/// Frames are buffered in memory and written to disk one chunk at a time.
+class ChApi ChTrajectoryWriter : public ChSystem::CustomStepCallback {
+  public:
+    ChTrajectoryWriter(const std::string& filename,  ///< name of the output file
+                       int fields = TRAJ_ALL,        ///< recorded fields (combination of ChTrajectoryField)
+                       unsigned int chunk_frames = 256  ///< number of frames per chunk
+                       );
+
+    /// Destructor. Flushes any buffered frames and finalizes the file (errors are ignored; call Close()
+    /// explicitly to be notified of I/O failures).
+    ~ChTrajectoryWriter();
+
+    /// Record one frame every 'interval' steps when used as an end-of-step callback (default: 1).
+    void SetOutputInterval(unsigned int interval) { m_interval = (interval > 0) ? interval : 1; }
+
+    /// Record the current state of all bodies in the given system.
+    void WriteFrame(ChSystem* system);
+
+    /// Flush buffered frames, write the chunk index, and close the file.
+    /// No further frames can be recorded after this call. Throws a ChException on an I/O error.
+    void Close();
+
+    /// Return the number of frames recorded so far.
+    size_t GetNumFrames() const { return m_num_frames; }
+
+  private:
+    virtual void OnEndStep(ChSystem* system) override;
+
+    void WriteHeader(ChSystem* system);
+    void FlushChunk();
+
+    std::ofstream m_file;
+    int m_fields;
+    unsigned int m_chunk_frames;
+    unsigned int m_interval;
+    unsigned int m_step_counter;
+    bool m_closed;
+
+    std::vector<std::shared_ptr<ChBody>> m_bodies;
+    size_t m_num_frames;
+    std::vector<double> m_time;                 ///< buffered frame times
+    std::vector<std::vector<double>> m_column;  ///< buffered columns, one per recorded field
+    std::vector<uint64_t> m_chunk_offsets;
+};
+
+/// Random-access reader for trajectory files produced by ChTrajectoryWriter.
+/// The file is memory mapped; per-frame columns are returned without copying.
+class ChApi ChTrajectoryReader {
+  public:
+    /// Open and map the specified trajectory file. Throws a ChException if the file is invalid.
+    ChTrajectoryReader(const std::string& filename);
+
+    ~ChTrajectoryReader();
+
+    /// Return the number of recorded frames.
+    size_t GetNumFrames() const { return m_num_frames; }
+
+    /// Return the number of recorded bodies.
+    size_t GetNumBodies() const { return m_identifiers.size(); }
+
+    /// Return true if the specified field was recorded.
+    bool HasField(ChTrajectoryField field) const { return (m_fields & field) != 0; }
+
+    /// Return the identifier of the body with specified index.
+    int GetBodyIdentifier(size_t body) const { return m_identifiers[body]; }
+
+    /// Return the index of the body with specified identifier, or -1 if not present.
+    int FindBody(int identifier) const;
+
+    /// Return the time of the specified frame.
+    double GetTime(size_t frame) const;
+
+    /// Return the index of the last frame with time not larger than the specified value.
+    size_t FindFrame(double time) const;
+
+    /// Return a pointer to the values of the given field for all bodies at the specified frame.
+    /// The returned array has GetNumComponents(field) values per body and remains valid for
+    /// the lifetime of the reader. Returns nullptr if the field was not recorded.
+    const double* GetFrameData(ChTrajectoryField field, size_t frame) const;
+
+    ChVector<> GetPos(size_t frame, size_t body) const { return GetVector(TRAJ_POS, frame, body); }
+    ChQuaternion<> GetRot(size_t frame, size_t body) const;
+    ChVector<> GetLinVel(size_t frame, size_t body) const { return GetVector(TRAJ_LIN_VEL, frame, body); }
+    ChVector<> GetAngVel(size_t frame, size_t body) const { return GetVector(TRAJ_ANG_VEL, frame, body); }
+    ChVector<> GetContactForce(size_t frame, size_t body) const { return GetVector(TRAJ_CONTACT_FORCE, frame, body); }
+    ChVector<> GetContactTorque(size_t frame, size_t body) const { return GetVector(TRAJ_CONTACT_TORQUE, frame, body); }
+
+    /// Return the number of values per body for the specified field.
+    static int GetNumComponents(ChTrajectoryField field) { return field == TRAJ_ROT ? 4 : 3; }
+
+  private:
+    ChVector<> GetVector(ChTrajectoryField field, size_t frame, size_t body) const;
+    const char* GetChunk(size_t frame, size_t& local_frame, size_t& chunk_frames) const;
+    void Unmap();
+
+    const char* m_data;
+    size_t m_size;
+#ifdef _WIN32
+    void* m_file_handle;
+    void* m_map_handle;
+#endif
+
+    int m_fields;
+    size_t m_chunk_frames;
+    size_t m_num_frames;
+    std::vector<int> m_identifiers;
+    std::vector<uint64_t> m_chunk_offsets;
+};
+
+/// @} chrono_utils
+
+}  // namespace utils
+}  // namespace chrono
+
+#endif
@@ -62,9 +62,26 @@ bool ChCosimulation::WaitConnection(int aport) {
     return true;
 }
 
+bool ChCosimulation::WaitConnectionSharedMemory(const std::string& name, size_t capacity) {
+    this->myChannel.Create(name, capacity);
+
+    // wait for a client to open the channel (this might put the program in
+    // a long waiting state)
+    return this->myChannel.WaitConnection();
+}
+
 bool ChCosimulation::SendData(double mtime, ChVectorConstRef out_data) {
     if (out_data.size() != this->out_n)
         throw ChExceptionSocket(0, "Error. Sent data must be a vector of size N.");
+
+    // Shared memory channel: a single typed message, no serialization
+    if (myChannel.IsOpen()) {
+        channelBuffer.resize(out_data.size());
+        for (int i = 0; i < out_data.size(); i++)
+            channelBuffer[i] = out_data(i);
+        return myChannel.Send(COSIM_DATA_MESSAGE, mtime, channelBuffer.data(), (uint32_t)channelBuffer.size());
+    }
+
     if (!myClient)
         throw ChExceptionSocket(0, "Error. Attempted 'SendData' with no connected client.");
 
@@ -88,6 +105,18 @@ bool ChCosimulation::SendData(double mtime, ChVectorConstRef out_data) {
 bool ChCosimulation::ReceiveData(double& mtime, ChVectorRef in_data) {
     if (in_data.size() != this->in_n)
         throw ChExceptionSocket(0, "Error. Received data must be a vector of size N.");
+
+    // Shared memory channel
+    if (myChannel.IsOpen()) {
+        uint32_t type;
+        myChannel.Receive(type, mtime, channelBuffer);
+        if (type != COSIM_DATA_MESSAGE || channelBuffer.size() != this->in_n)
+            throw ChExceptionSocket(0, "Error. Unexpected message received over the shared memory channel.");
+        for (int i = 0; i < in_data.size(); i++)
+            in_data(i) = channelBuffer[i];
+        return true;
+    }
+
     if (!myClient)
         throw ChExceptionSocket(0, "Error. Attempted 'ReceiveData' with no connected client.");
 
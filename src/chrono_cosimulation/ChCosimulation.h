@@ -15,6 +15,7 @@
 #ifndef CHCOSIMULATION_H
 #define CHCOSIMULATION_H
 
+#include "chrono_cosimulation/ChSharedMemoryChannel.h"
 #include "chrono_cosimulation/ChSocket.h"
 #include "chrono_cosimulation/ChSocketFramework.h"
 
@@ -34,6 +35,9 @@ namespace cosimul {
 /// back and forth.
 /// In this case, C::E will work as a server, waiting for
 /// a client to talk with.
+/// If the client runs on the same host, a shared memory
+/// channel (see ChSharedMemoryChannel) can be used instead
+/// of the TCP socket, by calling WaitConnectionSharedMemory().
 
 class ChApiCosimulation ChCosimulation {
   public:
@@ -50,6 +54,12 @@ class ChApiCosimulation ChCosimulation {
     /// \a aport is a free port number, for example 50009.
     bool WaitConnection(int aport);
 
+    /// Create a named shared memory channel (see ChSharedMemoryChannel)
+    /// and wait until a client opens it. Data is then exchanged through
+    /// the shared memory rings instead of the TCP socket, as messages of
+    /// type COSIM_DATA_MESSAGE. \a capacity is the ring size in bytes.
+    bool WaitConnectionSharedMemory(const std::string& name, size_t capacity = 1 << 20);
+
     /// Exchange data with the client, by sending a
     /// vector of floating point values over TCP socket
     /// connection (values are double precision, little endian, 4 bytes each)
@@ -62,7 +72,13 @@ class ChApiCosimulation ChCosimulation {
     /// External time is also received as first value.
     bool ReceiveData(double& mtime, ChVectorRef mdata);
 
+    /// Message type used for the data vectors over a shared memory channel.
+    static const uint32_t COSIM_DATA_MESSAGE = 1;
+
   private:
+    ChSharedMemoryChannel myChannel;
+    std::vector<double> channelBuffer;
+
     ChSocketTCP* myServer;
     ChSocketTCP* myClient;
     int nport;
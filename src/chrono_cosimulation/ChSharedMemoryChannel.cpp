@@ -0,0 +1,388 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "chrono_cosimulation/ChSharedMemoryChannel.h"
+#include "chrono_cosimulation/ChExceptionSocket.h"
+
+namespace chrono {
+namespace cosimul {
+
+static const uint64_t kMagic = 0x4d48534d49534f43ull;  // "COSIMSHM"
+static const uint32_t kVersion = 1;
+static const size_t kMessageHeader = 16;  // type (u32), count (u32), time (f64)
+
+// Values of the connection state in the segment header
+static const uint32_t kWaiting = 0;    // created, no client yet
+static const uint32_t kConnected = 1;  // both sides attached
+static const uint32_t kClosed = 2;     // one of the sides closed the channel
+
+// Segment header, on its own 64-byte line.
+struct SegmentHeader {
+    uint64_t magic;
+    uint32_t version;
+    std::atomic<uint32_t> connected;
+    uint64_t capacity;
+    char pad[40];
+};
+
+// Ring positions, each on its own 64-byte line to avoid false sharing between writer and reader.
+struct ChSharedMemoryChannel::Ring {
+    std::atomic<uint64_t> write_pos;
+    char pad1[56];
+    std::atomic<uint64_t> read_pos;
+    char pad2[56];
+
+    char* Data() { return reinterpret_cast<char*>(this + 1); }
+};
+
+static_assert(sizeof(SegmentHeader) == 64, "unexpected SegmentHeader size");
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shared memory channel requires lock-free 64-bit atomics");
+
+namespace {
+
+// Busy-wait helper: spin for a while, then yield the processor. Returns false on timeout.
+class Waiter {
+  public:
+    Waiter(double timeout) : m_timeout(timeout), m_iter(0), m_start(std::chrono::steady_clock::now()) {}
+
+    bool Wait() {
+        if (++m_iter < 1000)
+            return true;
+        std::this_thread::yield();
+        if (m_timeout < 0 || (m_iter % 256) != 0)
+            return true;
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_start;
+        return elapsed.count() < m_timeout;
+    }
+
+  private:
+    double m_timeout;
+    unsigned int m_iter;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+}  // end namespace
+
+ChSharedMemoryChannel::ChSharedMemoryChannel()
+    : m_segment(nullptr),
+      m_size(0),
+      m_capacity(0),
+      m_owner(false),
+#ifdef _WIN32
+      m_map_handle(nullptr),
+#endif
+      m_write_pos(0) {
+}
+
+ChSharedMemoryChannel::~ChSharedMemoryChannel() {
+    Close();
+}
+
+void ChSharedMemoryChannel::Create(const std::string& name, size_t capacity) {
+    if (IsOpen())
+        throw ChExceptionSocket(0, "Error. Shared memory channel already open.");
+
+    // Round the capacity up to a multiple of 8 bytes, so that values never straddle the ring end
+    capacity = ((capacity + 7) / 8) * 8;
+    if (capacity < 2 * kMessageHeader)
+        throw ChExceptionSocket(0, "Error. Shared memory ring capacity too small.");
+
+    Map(name, sizeof(SegmentHeader) + 2 * (sizeof(Ring) + capacity), true);
+    m_owner = true;
+    m_capacity = capacity;
+
+    auto header = reinterpret_cast<SegmentHeader*>(m_segment);
+    for (int i = 0; i < 2; i++) {
+        GetRing(i)->write_pos.store(0, std::memory_order_relaxed);
+        GetRing(i)->read_pos.store(0, std::memory_order_relaxed);
+    }
+    header->version = kVersion;
+    header->capacity = capacity;
+    header->connected.store(kWaiting, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = kMagic;
+    m_write_pos = 0;
+}
+
+void ChSharedMemoryChannel::Open(const std::string& name) {
+    if (IsOpen())
+        throw ChExceptionSocket(0, "Error. Shared memory channel already open.");
+
+    Map(name, 0, false);
+    m_owner = false;
+
+    auto header = reinterpret_cast<SegmentHeader*>(m_segment);
+    if (m_size < sizeof(SegmentHeader) || header->magic != kMagic || header->version != kVersion) {
+        Close();
+        throw ChExceptionSocket(0, "Error. Invalid shared memory segment: " + name);
+    }
+
+    // The rings must fit in the mapped segment (the size is checked first, so the sum cannot overflow)
+    uint64_t capacity = header->capacity;
+    if (capacity < 2 * kMessageHeader || capacity % 8 != 0 || capacity > m_size ||
+        sizeof(SegmentHeader) + 2 * (sizeof(Ring) + capacity) > m_size) {
+        Close();
+        throw ChExceptionSocket(0, "Error. Shared memory segment too small for its rings: " + name);
+    }
+    if (header->connected.load(std::memory_order_acquire) != kWaiting) {
+        Close();
+        throw ChExceptionSocket(0, "Error. Shared memory segment already connected or closed: " + name);
+    }
+
+    m_capacity = capacity;
+    m_write_pos = GetRing(1)->write_pos.load(std::memory_order_relaxed);
+    header->connected.store(kConnected, std::memory_order_release);
+}
+
+bool ChSharedMemoryChannel::IsConnected() const {
+    if (!IsOpen())
+        return false;
+    return reinterpret_cast<SegmentHeader*>(m_segment)->connected.load(std::memory_order_acquire) == kConnected;
+}
+
+bool ChSharedMemoryChannel::WaitConnection(double timeout) {
+    if (!IsOpen())
+        throw ChExceptionSocket(0, "Error. Attempted 'WaitConnection' on a closed shared memory channel.");
+
+    auto header = reinterpret_cast<SegmentHeader*>(m_segment);
+    Waiter waiter(timeout);
+    while (header->connected.load(std::memory_order_acquire) == kWaiting) {
+        if (!waiter.Wait())
+            return false;
+    }
+    return IsConnected();
+}
+
+void ChSharedMemoryChannel::MarkClosed() {
+    // Only a valid segment has a header to update (Open may close a segment that failed validation)
+    auto header = reinterpret_cast<SegmentHeader*>(m_segment);
+    if (m_size >= sizeof(SegmentHeader) && header->magic == kMagic && m_capacity > 0)
+        header->connected.store(kClosed, std::memory_order_release);
+}
+
+ChSharedMemoryChannel::Ring* ChSharedMemoryChannel::GetRing(int which) const {
+    return reinterpret_cast<Ring*>(m_segment + sizeof(SegmentHeader) + which * (sizeof(Ring) + m_capacity));
+}
+
+void ChSharedMemoryChannel::CopyIn(Ring* ring, uint64_t pos, const void* src, size_t n) {
+    size_t offset = pos % m_capacity;
+    size_t first = std::min(n, m_capacity - offset);
+    std::memcpy(ring->Data() + offset, src, first);
+    std::memcpy(ring->Data(), static_cast<const char*>(src) + first, n - first);
+}
+
+void ChSharedMemoryChannel::CopyOut(Ring* ring, uint64_t pos, void* dst, size_t n) const {
+    size_t offset = pos % m_capacity;
+    size_t first = std::min(n, m_capacity - offset);
+    std::memcpy(dst, ring->Data() + offset, first);
+    std::memcpy(static_cast<char*>(dst) + first, ring->Data(), n - first);
+}
+
+bool ChSharedMemoryChannel::Write(uint32_t type, double time, const double* values, uint32_t count, double timeout) {
+    if (!IsOpen())
+        throw ChExceptionSocket(0, "Error. Attempted 'Write' on a closed shared memory channel.");
+
+    size_t nbytes = kMessageHeader + sizeof(double) * count;
+    if (nbytes > m_capacity)
+        throw ChExceptionSocket(0, "Error. Message larger than the shared memory ring capacity.");
+
+    Ring* ring = GetRing(m_owner ? 0 : 1);
+
+    // Wait for enough free space; publish pending messages first, so that the reader can make progress.
+    // Give up if the reader closed the channel (its ring would never be drained) or on timeout.
+    if (m_write_pos + nbytes - ring->read_pos.load(std::memory_order_acquire) > m_capacity) {
+        Flush();
+        auto header = reinterpret_cast<SegmentHeader*>(m_segment);
+        Waiter waiter(timeout);
+        while (m_write_pos + nbytes - ring->read_pos.load(std::memory_order_acquire) > m_capacity) {
+            if (header->connected.load(std::memory_order_acquire) == kClosed)
+                throw ChExceptionSocket(0, "Error. Shared memory channel closed by the other side.");
+            if (!waiter.Wait())
+                return false;
+        }
+    }
+
+    char header[kMessageHeader];
+    std::memcpy(header, &type, 4);
+    std::memcpy(header + 4, &count, 4);
+    std::memcpy(header + 8, &time, 8);
+    CopyIn(ring, m_write_pos, header, kMessageHeader);
+    CopyIn(ring, m_write_pos + kMessageHeader, values, sizeof(double) * count);
+    m_write_pos += nbytes;
+    return true;
+}
+
+void ChSharedMemoryChannel::Flush() {
+    if (!IsOpen())
+        throw ChExceptionSocket(0, "Error. Attempted 'Flush' on a closed shared memory channel.");
+
+    GetRing(m_owner ? 0 : 1)->write_pos.store(m_write_pos, std::memory_order_release);
+}
+
+bool ChSharedMemoryChannel::Receive(uint32_t& type, double& time, std::vector<double>& values, double timeout) {
+    if (!IsOpen())
+        throw ChExceptionSocket(0, "Error. Attempted 'Receive' on a closed shared memory channel.");
+
+    Ring* ring = GetRing(m_owner ? 1 : 0);
+    uint64_t read_pos = ring->read_pos.load(std::memory_order_relaxed);
+
+    // Messages are published whole, so the header and the values are available together
+    auto segment_header = reinterpret_cast<SegmentHeader*>(m_segment);
+    Waiter waiter(timeout);
+    while (ring->write_pos.load(std::memory_order_acquire) == read_pos) {
+        if (segment_header->connected.load(std::memory_order_acquire) == kClosed)
+            throw ChExceptionSocket(0, "Error. Shared memory channel closed by the other side.");
+        if (!waiter.Wait())
+            return false;
+    }
+
+    char header[kMessageHeader];
+    uint32_t count;
+    CopyOut(ring, read_pos, header, kMessageHeader);
+    std::memcpy(&type, header, 4);
+    std::memcpy(&count, header + 4, 4);
+    std::memcpy(&time, header + 8, 8);
+
+    // Reject a corrupted header rather than reading past the ring
+    size_t nbytes = kMessageHeader + sizeof(double) * count;
+    if (count > (m_capacity - kMessageHeader) / sizeof(double) ||
+        nbytes > ring->write_pos.load(std::memory_order_relaxed) - read_pos)
+        throw ChExceptionSocket(0, "Error. Invalid message in shared memory channel.");
+
+    values.resize(count);
+    CopyOut(ring, read_pos + kMessageHeader, values.data(), sizeof(double) * count);
+
+    ring->read_pos.store(read_pos + nbytes, std::memory_order_release);
+    return true;
+}
+
+#ifdef _WIN32
+
+void ChSharedMemoryChannel::Map(const std::string& name, size_t size, bool create) {
+    std::string mapname = "Local\\" + name;
+    HANDLE hmap;
+    if (create) {
+        hmap = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)((uint64_t)size >> 32),
+                                  (DWORD)(size & 0xFFFFFFFF), mapname.c_str());
+    } else {
+        hmap = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, mapname.c_str());
+    }
+    if (!hmap)
+        throw ChExceptionSocket((int)GetLastError(), "Error. Cannot access shared memory segment: " + name);
+
+    void* data = MapViewOfFile(hmap, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (!data) {
+        CloseHandle(hmap);
+        throw ChExceptionSocket((int)GetLastError(), "Error. Cannot map shared memory segment: " + name);
+    }
+
+    if (!create) {
+        MEMORY_BASIC_INFORMATION info;
+        VirtualQuery(data, &info, sizeof(info));
+        size = info.RegionSize;
+    }
+
+    m_map_handle = hmap;
+    m_segment = static_cast<char*>(data);
+    m_size = size;
+    m_name = name;
+}
+
+void ChSharedMemoryChannel::Close() {
+    if (m_segment) {
+        MarkClosed();
+        UnmapViewOfFile(m_segment);
+    }
+    if (m_map_handle)
+        CloseHandle(m_map_handle);
+    m_segment = nullptr;
+    m_map_handle = nullptr;
+    m_size = 0;
+    m_capacity = 0;
+    m_owner = false;
+}
+
+#else
+
+void ChSharedMemoryChannel::Map(const std::string& name, size_t size, bool create) {
+    std::string shmname = "/" + name;
+    int fd;
+    if (create) {
+        // Remove a stale segment left over by a previous run
+        shm_unlink(shmname.c_str());
+        fd = shm_open(shmname.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd >= 0 && ftruncate(fd, size) != 0) {
+            close(fd);
+            shm_unlink(shmname.c_str());
+            fd = -1;
+        }
+    } else {
+        fd = shm_open(shmname.c_str(), O_RDWR, 0600);
+        struct stat st;
+        if (fd >= 0) {
+            if (fstat(fd, &st) == 0) {
+                size = st.st_size;
+            } else {
+                close(fd);
+                fd = -1;
+            }
+        }
+    }
+    if (fd < 0)
+        throw ChExceptionSocket(errno, "Error. Cannot access shared memory segment: " + name);
+
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        if (create)
+            shm_unlink(shmname.c_str());
+        throw ChExceptionSocket(errno, "Error. Cannot map shared memory segment: " + name);
+    }
+
+    m_segment = static_cast<char*>(data);
+    m_size = size;
+    m_name = name;
+}
+
+void ChSharedMemoryChannel::Close() {
+    if (m_segment) {
+        MarkClosed();
+        munmap(m_segment, m_size);
+        if (m_owner)
+            shm_unlink(("/" + m_name).c_str());
+    }
+    m_segment = nullptr;
+    m_size = 0;
+    m_capacity = 0;
+    m_owner = false;
+}
+
+#endif
+
+}  // end namespace cosimul
+}  // end namespace chrono
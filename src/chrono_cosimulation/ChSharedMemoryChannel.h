@@ -0,0 +1,131 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Shared-memory transport for co-simulation between processes on the same host.
+//
+// A named shared memory segment holds two single-producer/single-consumer ring
+// buffers, one per direction. The process that creates the segment (server)
+// writes to ring 0 and reads from ring 1; the process that opens it (client)
+// does the opposite.
+//
+// Segment layout (all values in native byte order):
+//    header:  magic (u64), version (u32), connection state (u32), ring capacity in bytes (u64)
+//    rings:   two rings, each made of a write position (u64) and a read position (u64),
+//             each on its own 64-byte line, followed by 'capacity' bytes of data
+//
+// Ring positions increase monotonically; the data offset is position % capacity.
+// Each message is a 16-byte record {type (u32), count (u32), time (f64)} followed
+// by 'count' f64 values. Several messages can be written before publishing them
+// with a single update of the write position (see Write() and Flush()).
+//
+// =============================================================================
+
+#ifndef CHSHAREDMEMORYCHANNEL_H
+#define CHSHAREDMEMORYCHANNEL_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "chrono_cosimulation/ChApiCosimulation.h"
+
+namespace chrono {
+namespace cosimul {
+
+/// @addtogroup cosimulation_module
+/// @{
+
+/// Bidirectional message channel through a named shared memory segment.
+/// Messages are typed (a user-defined integer identifier) and carry a time stamp and
+/// a vector of double precision values. All methods throw a ChExceptionSocket on error.
+class ChApiCosimulation ChSharedMemoryChannel {
+  public:
+    ChSharedMemoryChannel();
+    ~ChSharedMemoryChannel();
+
+    /// Create the named segment, with the given capacity (in bytes) for each direction.
+    /// The segment is removed when the channel is closed.
+    void Create(const std::string& name, size_t capacity = 1 << 20);
+
+    /// Open a named segment previously created by another process, and signal the connection.
+    /// Throws if the segment is not a valid channel or already has a client.
+    void Open(const std::string& name);
+
+    /// Unmap the segment (and remove it, if this channel created it).
+    /// The other side is notified; its pending or subsequent blocking calls then throw.
+    void Close();
+
+    /// Return true if the channel is attached to a segment.
+    bool IsOpen() const { return m_segment != nullptr; }
+
+    /// Return true if the other side is attached to the segment.
+    bool IsConnected() const;
+
+    /// Wait until a client opens the segment created by this channel.
+    /// Returns false if no connection was made within the specified time (negative: wait forever)
+    /// or if the channel was closed.
+    bool WaitConnection(double timeout = -1);
+
+    /// Append a message to the outgoing ring, without making it visible to the reader.
+    /// Blocks while there is not enough free space in the ring, at most for the specified time (in seconds;
+    /// negative: wait forever), in which case it returns false and the message is not written.
+    /// Throws if the other side closes the channel while waiting.
+    bool Write(uint32_t type, double time, const double* values, uint32_t count, double timeout = -1);
+
+    /// Make all messages written since the last call visible to the reader.
+    void Flush();
+
+    /// Write a message and flush it. Returns false if the message could not be written within the
+    /// specified time (see Write).
+    bool Send(uint32_t type, double time, const double* values, uint32_t count, double timeout = -1) {
+        if (!Write(type, time, values, count, timeout))
+            return false;
+        Flush();
+        return true;
+    }
+
+    /// Receive the next message. Blocks until a message is available or the specified time
+    /// (in seconds; negative: wait forever) has elapsed, in which case it returns false.
+    /// Throws if the other side closes the channel while waiting, or if the message is invalid.
+    bool Receive(uint32_t& type, double& time, std::vector<double>& values, double timeout = -1);
+
+    /// Return the ring capacity (bytes per direction).
+    size_t GetCapacity() const { return m_capacity; }
+
+  private:
+    struct Ring;
+
+    void Map(const std::string& name, size_t size, bool create);
+    void MarkClosed();
+    Ring* GetRing(int which) const;
+    void CopyIn(Ring* ring, uint64_t pos, const void* src, size_t n);
+    void CopyOut(Ring* ring, uint64_t pos, void* dst, size_t n) const;
+
+    char* m_segment;
+    size_t m_size;
+    size_t m_capacity;
+    bool m_owner;
+    std::string m_name;
+#ifdef _WIN32
+    void* m_map_handle;
+#endif
+
+    uint64_t m_write_pos;  ///< local (unpublished) write position in the outgoing ring
+};
+
+/// @} cosimulation_module
+
+}  // end namespace cosimul
+}  // end namespace chrono
+
+#endif
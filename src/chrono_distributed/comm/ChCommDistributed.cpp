@@ -14,10 +14,12 @@
 
 #include <mpi.h>
 #include <omp.h>
+#include <algorithm>
 #include <climits>
 #include <forward_list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "chrono_distributed/ChDistributedDataManager.h"
 #include "chrono_distributed/collision/ChCollisionModelDistributed.h"
@@ -264,8 +266,9 @@ void ChCommDistributed::ProcessShapes(int num_recv, Shape* buf) {
     }
 }
 
-// Handle all necessary communication
-void ChCommDistributed::Exchange() {
+// Pack the bodies that must be sent to the neighbor ranks and post all sends, together with the
+// receives of the message counts. The receives of the messages are posted in CompleteExchange.
+void ChCommDistributed::PostExchange() {
     int my_rank = my_sys->my_rank;
     int num_ranks = my_sys->num_ranks;
     std::forward_list<int> exchanges_up;
@@ -273,14 +276,14 @@ void ChCommDistributed::Exchange() {
 
     // Saves a reference copy for consistency in the threads.
     ddm->curr_status = ddm->comm_status;
-    std::vector<BodyExchange> exchange_up_buf;
-    std::vector<BodyExchange> exchange_down_buf;
-    std::vector<BodyUpdate> update_up_buf;
-    std::vector<BodyUpdate> update_down_buf;
-    std::vector<Shape> shapes_up;
-    std::vector<Shape> shapes_down;
-    std::vector<uint> update_take_up;
-    std::vector<uint> update_take_down;
+    exchange_up_buf.clear();
+    exchange_down_buf.clear();
+    update_up_buf.clear();
+    update_down_buf.clear();
+    shapes_up.clear();
+    shapes_down.clear();
+    update_take_up.clear();
+    update_take_down.clear();
 
     // Send Counts
     int num_exchange_up = 0;
@@ -440,182 +443,8 @@ void ChCommDistributed::Exchange() {
         }      // End of update take loop
     }          // End of parallel sections
 
-    // MPI_Status status_exchange_up;
-    // MPI_Status status_exchange_down;
-    // MPI_Status status_update_up;
-    // MPI_Status status_update_down;
-    // MPI_Status status_take_up;
-    // MPI_Status status_take_down;
-    // MPI_Status status_shapes_up;
-    // MPI_Status status_shapes_down;
-
-    MPI_Request rq_exchange_up;
-    MPI_Request rq_exchange_down;
-    MPI_Request rq_update_up;
-    MPI_Request rq_update_down;
-    MPI_Request rq_take_up;
-    MPI_Request rq_take_down;
-    MPI_Request rq_shapes_up;
-    MPI_Request rq_shapes_down;
-
-    MPI_Status recv_status_exchange_up;
-    MPI_Status recv_status_exchange_down;
-    MPI_Status recv_status_update_up;
-    MPI_Status recv_status_update_down;
-    MPI_Status recv_status_take_up;
-    MPI_Status recv_status_take_down;
-    MPI_Status recv_status_shapes_up;
-    MPI_Status recv_status_shapes_down;
-
-    int num_recv_exchange_up;
-    int num_recv_exchange_down;
-    int num_recv_update_up;
-    int num_recv_update_down;
-    int num_recv_take_up;
-    int num_recv_take_down;
-    int num_recv_shapes_up;
-    int num_recv_shapes_down;
-
-    BodyExchange* recv_exchange_down = NULL;
-    BodyExchange* recv_exchange_up = NULL;
-    BodyUpdate* recv_update_down = NULL;
-    BodyUpdate* recv_update_up = NULL;
-    uint* recv_take_down = NULL;
-    uint* recv_take_up = NULL;
-    Shape* recv_shapes_down = NULL;
-    Shape* recv_shapes_up = NULL;
-
 #pragma omp parallel sections
     {
-// Send/Recv
-#pragma omp section
-        {
-            // SENDING - TODO sequential for now
-
-            // Send empty message if there is nothing to send
-            if (num_exchange_up == 0) {
-                BodyExchange b_e = {};
-                b_e.gid = UINT_MAX;
-                exchange_up_buf.push_back(b_e);
-                num_exchange_up = 1;
-            }
-            if (num_exchange_down == 0) {
-                BodyExchange b_e = {};
-                b_e.gid = UINT_MAX;
-                exchange_down_buf.push_back(b_e);
-                num_exchange_down = 1;
-            }
-            if (num_update_up == 0) {
-                BodyUpdate b_u = {};
-                b_u.gid = UINT_MAX;
-                update_up_buf.push_back(b_u);
-                num_update_up = 1;
-            }
-            if (num_update_down == 0) {
-                BodyUpdate b_u = {};
-                b_u.gid = UINT_MAX;
-                update_down_buf.push_back(b_u);
-                num_update_down = 1;
-            }
-            if (num_take_up == 0) {
-                update_take_up.push_back(UINT_MAX);
-                num_take_up = 1;
-            }
-            if (num_take_down == 0) {
-                update_take_down.push_back(UINT_MAX);
-                num_take_down = 1;
-            }
-
-            // Send Exchanges
-            if (my_rank != num_ranks - 1) {
-                MPI_Isend(&(exchange_up_buf[0]), num_exchange_up, BodyExchangeType, my_rank + 1, 1, my_sys->world,
-                          &rq_exchange_up);
-            }
-            if (my_rank != 0) {
-                MPI_Isend(&(exchange_down_buf[0]), num_exchange_down, BodyExchangeType, my_rank - 1, 2, my_sys->world,
-                          &rq_exchange_down);
-            }
-
-            // Recv Exchanges
-            if (my_rank != 0) {
-                MPI_Probe(my_rank - 1, 1, my_sys->world, &recv_status_exchange_down);
-                MPI_Get_count(&recv_status_exchange_down, BodyExchangeType, &num_recv_exchange_down);
-                recv_exchange_down = new BodyExchange[num_recv_exchange_down];
-                MPI_Recv(recv_exchange_down, num_recv_exchange_down, BodyExchangeType, my_rank - 1, 1, my_sys->world,
-                         &recv_status_exchange_down);
-            }
-            if (my_rank != num_ranks - 1) {
-                MPI_Probe(my_rank + 1, 2, my_sys->world, &recv_status_exchange_up);
-                MPI_Get_count(&recv_status_exchange_up, BodyExchangeType, &num_recv_exchange_up);
-                recv_exchange_up = new BodyExchange[num_recv_exchange_up];
-                MPI_Recv(recv_exchange_up, num_recv_exchange_up, BodyExchangeType, my_rank + 1, 2, my_sys->world,
-                         &recv_status_exchange_up);
-            }
-
-            // Send Updates
-            if (my_rank != num_ranks - 1) {
-                MPI_Isend(&(update_up_buf[0]), num_update_up, BodyUpdateType, my_rank + 1, 3, my_sys->world,
-                          &rq_update_up);
-            }
-            if (my_rank != 0) {
-                MPI_Isend(&(update_down_buf[0]), num_update_down, BodyUpdateType, my_rank - 1, 4, my_sys->world,
-                          &rq_update_down);
-            }
-
-            // Recv Updates
-            if (my_rank != 0) {
-                MPI_Probe(my_rank - 1, 3, my_sys->world, &recv_status_update_down);
-                MPI_Get_count(&recv_status_update_down, BodyUpdateType, &num_recv_update_down);
-                recv_update_down = new BodyUpdate[num_recv_update_down];
-                MPI_Recv(recv_update_down, num_recv_update_down, BodyUpdateType, my_rank - 1, 3, my_sys->world,
-                         &recv_status_update_down);
-            }
-            if (my_rank != num_ranks - 1) {
-                MPI_Probe(my_rank + 1, 4, my_sys->world, &recv_status_update_up);
-                MPI_Get_count(&recv_status_update_up, BodyUpdateType, &num_recv_update_up);
-                recv_update_up = new BodyUpdate[num_recv_update_up];
-                MPI_Recv(recv_update_up, num_recv_update_up, BodyUpdateType, my_rank + 1, 4, my_sys->world,
-                         &recv_status_update_up);
-            }
-
-            // Send Takes
-            if (my_rank != num_ranks - 1) {
-                MPI_Isend(&(update_take_up[0]), num_take_up, MPI_UNSIGNED, my_rank + 1, 5, my_sys->world, &rq_take_up);
-            }
-            if (my_rank != 0) {
-                MPI_Isend(&(update_take_down[0]), num_take_down, MPI_UNSIGNED, my_rank - 1, 6, my_sys->world,
-                          &rq_take_down);
-            }
-
-            // Recv Takes
-            if (my_rank != 0) {
-                MPI_Probe(my_rank - 1, 5, my_sys->world, &recv_status_take_down);
-                MPI_Get_count(&recv_status_take_down, MPI_UNSIGNED, &num_recv_take_down);
-                recv_take_down = new uint[num_recv_take_down];
-                MPI_Recv(recv_take_down, num_recv_take_down, MPI_UNSIGNED, my_rank - 1, 5, my_sys->world,
-                         &recv_status_take_down);
-            }
-            if (my_rank != num_ranks - 1) {
-                MPI_Probe(my_rank + 1, 6, my_sys->world, &recv_status_take_up);
-                MPI_Get_count(&recv_status_take_up, MPI_UNSIGNED, &num_recv_take_up);
-                recv_take_up = new uint[num_recv_take_up];
-                MPI_Recv(recv_take_up, num_recv_take_up, MPI_UNSIGNED, my_rank + 1, 6, my_sys->world,
-                         &recv_status_take_up);
-            }
-
-            // Make sure all non-blocking communications are done.
-            if (my_rank != num_ranks - 1) {
-                MPI_Wait(&rq_exchange_up, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_update_up, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_take_up, MPI_STATUS_IGNORE);
-            }
-            if (my_rank != 0) {
-                MPI_Wait(&rq_exchange_down, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_update_down, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_take_down, MPI_STATUS_IGNORE);
-            }
-        }  // End of send/recv section
-
 // TODO could do in parallel if counting the spaces in the buffers in the first pass
 // Pack Shapes Up
 #pragma omp section
@@ -623,13 +452,6 @@ void ChCommDistributed::Exchange() {
             for (auto itr_up = exchanges_up.begin(); itr_up != exchanges_up.end(); itr_up++) {
                 num_shapes_up += PackShapes(&shapes_up, *itr_up);
             }
-
-            if (num_shapes_up == 0) {
-                Shape shape;
-                shape.gid = UINT_MAX;
-                shapes_up.push_back(shape);
-                num_shapes_up = 1;
-            }
         }  // End of pack shapes up section
 
 // Pack Shapes Down
@@ -638,78 +460,171 @@ void ChCommDistributed::Exchange() {
             for (auto itr_down = exchanges_down.begin(); itr_down != exchanges_down.end(); itr_down++) {
                 num_shapes_down += PackShapes(&shapes_down, *itr_down);
             }
-            if (num_shapes_down == 0) {
-                Shape shape;
-                shape.gid = UINT_MAX;
-                shapes_down.push_back(shape);
-                num_shapes_down = 1;
-            }
         }  // End of pack shapes down section
     }      // End of parallel sections
 
-    // TODO sections?
-    if (my_rank != 0)
-        ProcessExchanges(num_recv_exchange_down, recv_exchange_down, 0);
-    if (my_rank != num_ranks - 1)
-        ProcessExchanges(num_recv_exchange_up, recv_exchange_up, 1);
-
-    if (my_rank != 0)
-        ProcessUpdates(num_recv_update_down, recv_update_down);
-    if (my_rank != num_ranks - 1)
-        ProcessUpdates(num_recv_update_up, recv_update_up);
+    // Send empty message if there is nothing to send
+    if (num_exchange_up == 0) {
+        BodyExchange b_e = {};
+        b_e.gid = UINT_MAX;
+        exchange_up_buf.push_back(b_e);
+        num_exchange_up = 1;
+    }
+    if (num_exchange_down == 0) {
+        BodyExchange b_e = {};
+        b_e.gid = UINT_MAX;
+        exchange_down_buf.push_back(b_e);
+        num_exchange_down = 1;
+    }
+    if (num_update_up == 0) {
+        BodyUpdate b_u = {};
+        b_u.gid = UINT_MAX;
+        update_up_buf.push_back(b_u);
+        num_update_up = 1;
+    }
+    if (num_update_down == 0) {
+        BodyUpdate b_u = {};
+        b_u.gid = UINT_MAX;
+        update_down_buf.push_back(b_u);
+        num_update_down = 1;
+    }
+    if (num_take_up == 0) {
+        update_take_up.push_back(UINT_MAX);
+        num_take_up = 1;
+    }
+    if (num_take_down == 0) {
+        update_take_down.push_back(UINT_MAX);
+        num_take_down = 1;
+    }
+    if (num_shapes_up == 0) {
+        Shape shape;
+        shape.gid = UINT_MAX;
+        shapes_up.push_back(shape);
+        num_shapes_up = 1;
+    }
+    if (num_shapes_down == 0) {
+        Shape shape;
+        shape.gid = UINT_MAX;
+        shapes_down.push_back(shape);
+        num_shapes_down = 1;
+    }
 
-    if (my_rank != 0)
-        ProcessTakes(num_recv_take_down, recv_take_down);
-    if (my_rank != num_ranks - 1)
-        ProcessTakes(num_recv_take_up, recv_take_up);
+    send_requests.assign(10, MPI_REQUEST_NULL);
+    count_requests.assign(2, MPI_REQUEST_NULL);
 
-    // Send Shapes
+    // Send Up (the message counts let the upper neighbor post its receives with the right sizes)
     if (my_rank != num_ranks - 1) {
-        MPI_Isend(&(shapes_up[0]), num_shapes_up, ShapeType, my_rank + 1, 7, my_sys->world, &rq_shapes_up);
+        send_counts_up[0] = num_exchange_up;
+        send_counts_up[1] = num_update_up;
+        send_counts_up[2] = num_take_up;
+        send_counts_up[3] = num_shapes_up;
+        MPI_Isend(send_counts_up, 4, MPI_INT, my_rank + 1, 9, my_sys->world, &send_requests[0]);
+        MPI_Isend(&(exchange_up_buf[0]), num_exchange_up, BodyExchangeType, my_rank + 1, 1, my_sys->world,
+                  &send_requests[1]);
+        MPI_Isend(&(update_up_buf[0]), num_update_up, BodyUpdateType, my_rank + 1, 3, my_sys->world,
+                  &send_requests[2]);
+        MPI_Isend(&(update_take_up[0]), num_take_up, MPI_UNSIGNED, my_rank + 1, 5, my_sys->world, &send_requests[3]);
+        MPI_Isend(&(shapes_up[0]), num_shapes_up, ShapeType, my_rank + 1, 7, my_sys->world, &send_requests[4]);
+
+        MPI_Irecv(recv_counts_up, 4, MPI_INT, my_rank + 1, 10, my_sys->world, &count_requests[0]);
     }
+
+    // Send Down
     if (my_rank != 0) {
-        MPI_Isend(&(shapes_down[0]), num_shapes_down, ShapeType, my_rank - 1, 8, my_sys->world, &rq_shapes_down);
+        send_counts_down[0] = num_exchange_down;
+        send_counts_down[1] = num_update_down;
+        send_counts_down[2] = num_take_down;
+        send_counts_down[3] = num_shapes_down;
+        MPI_Isend(send_counts_down, 4, MPI_INT, my_rank - 1, 10, my_sys->world, &send_requests[5]);
+        MPI_Isend(&(exchange_down_buf[0]), num_exchange_down, BodyExchangeType, my_rank - 1, 2, my_sys->world,
+                  &send_requests[6]);
+        MPI_Isend(&(update_down_buf[0]), num_update_down, BodyUpdateType, my_rank - 1, 4, my_sys->world,
+                  &send_requests[7]);
+        MPI_Isend(&(update_take_down[0]), num_take_down, MPI_UNSIGNED, my_rank - 1, 6, my_sys->world,
+                  &send_requests[8]);
+        MPI_Isend(&(shapes_down[0]), num_shapes_down, ShapeType, my_rank - 1, 8, my_sys->world, &send_requests[9]);
+
+        MPI_Irecv(recv_counts_down, 4, MPI_INT, my_rank - 1, 9, my_sys->world, &count_requests[1]);
     }
+}
+
+// Receive the messages posted by the neighbor ranks in PostExchange and process them
+void ChCommDistributed::CompleteExchange() {
+    int my_rank = my_sys->my_rank;
+    int num_ranks = my_sys->num_ranks;
 
-    // Recv Shapes
+    // The message counts are needed to size the receive buffers
+    MPI_Waitall(2, count_requests.data(), MPI_STATUSES_IGNORE);
+
+    std::vector<BodyExchange> recv_exchange_down;
+    std::vector<BodyExchange> recv_exchange_up;
+    std::vector<BodyUpdate> recv_update_down;
+    std::vector<BodyUpdate> recv_update_up;
+    std::vector<uint> recv_take_down;
+    std::vector<uint> recv_take_up;
+    std::vector<Shape> recv_shapes_down;
+    std::vector<Shape> recv_shapes_up;
+
+    MPI_Request recv_requests[8];
+    std::fill(recv_requests, recv_requests + 8, MPI_REQUEST_NULL);
+
+    // Recv Down
     if (my_rank != 0) {
-        MPI_Probe(my_rank - 1, 7, my_sys->world, &recv_status_shapes_down);
-        MPI_Get_count(&recv_status_shapes_down, ShapeType, &num_recv_shapes_down);
-        recv_shapes_down = new Shape[num_recv_shapes_down];
-        MPI_Recv(recv_shapes_down, num_recv_shapes_down, ShapeType, my_rank - 1, 7, my_sys->world,
-                 &recv_status_shapes_down);
+        recv_exchange_down.resize(recv_counts_down[0]);
+        recv_update_down.resize(recv_counts_down[1]);
+        recv_take_down.resize(recv_counts_down[2]);
+        recv_shapes_down.resize(recv_counts_down[3]);
+        MPI_Irecv(recv_exchange_down.data(), recv_counts_down[0], BodyExchangeType, my_rank - 1, 1, my_sys->world,
+                  &recv_requests[0]);
+        MPI_Irecv(recv_update_down.data(), recv_counts_down[1], BodyUpdateType, my_rank - 1, 3, my_sys->world,
+                  &recv_requests[1]);
+        MPI_Irecv(recv_take_down.data(), recv_counts_down[2], MPI_UNSIGNED, my_rank - 1, 5, my_sys->world,
+                  &recv_requests[2]);
+        MPI_Irecv(recv_shapes_down.data(), recv_counts_down[3], ShapeType, my_rank - 1, 7, my_sys->world,
+                  &recv_requests[3]);
     }
+
+    // Recv Up
     if (my_rank != num_ranks - 1) {
-        MPI_Probe(my_rank + 1, 8, my_sys->world, &recv_status_shapes_up);
-        MPI_Get_count(&recv_status_shapes_up, ShapeType, &num_recv_shapes_up);
-        ////GetLog() << "num_recv_shapes_up" << num_recv_shapes_up << "\n";
-        recv_shapes_up = new Shape[num_recv_shapes_up];
-        MPI_Recv(recv_shapes_up, num_recv_shapes_up, ShapeType, my_rank + 1, 8, my_sys->world, &recv_status_shapes_up);
+        recv_exchange_up.resize(recv_counts_up[0]);
+        recv_update_up.resize(recv_counts_up[1]);
+        recv_take_up.resize(recv_counts_up[2]);
+        recv_shapes_up.resize(recv_counts_up[3]);
+        MPI_Irecv(recv_exchange_up.data(), recv_counts_up[0], BodyExchangeType, my_rank + 1, 2, my_sys->world,
+                  &recv_requests[4]);
+        MPI_Irecv(recv_update_up.data(), recv_counts_up[1], BodyUpdateType, my_rank + 1, 4, my_sys->world,
+                  &recv_requests[5]);
+        MPI_Irecv(recv_take_up.data(), recv_counts_up[2], MPI_UNSIGNED, my_rank + 1, 6, my_sys->world,
+                  &recv_requests[6]);
+        MPI_Irecv(recv_shapes_up.data(), recv_counts_up[3], ShapeType, my_rank + 1, 8, my_sys->world,
+                  &recv_requests[7]);
     }
 
+    MPI_Waitall(8, recv_requests, MPI_STATUSES_IGNORE);
+
+    // TODO sections?
     if (my_rank != 0)
-        ProcessShapes(num_recv_shapes_down, recv_shapes_down);
+        ProcessExchanges(recv_counts_down[0], recv_exchange_down.data(), 0);
     if (my_rank != num_ranks - 1)
-        ProcessShapes(num_recv_shapes_up, recv_shapes_up);
+        ProcessExchanges(recv_counts_up[0], recv_exchange_up.data(), 1);
 
-    if (my_rank != num_ranks - 1) {
-        MPI_Wait(&rq_shapes_up, MPI_STATUS_IGNORE);
-    }
-    if (my_rank != 0) {
-        MPI_Wait(&rq_shapes_down, MPI_STATUS_IGNORE);
-    }
+    if (my_rank != 0)
+        ProcessUpdates(recv_counts_down[1], recv_update_down.data());
+    if (my_rank != num_ranks - 1)
+        ProcessUpdates(recv_counts_up[1], recv_update_up.data());
+
+    if (my_rank != 0)
+        ProcessTakes(recv_counts_down[2], recv_take_down.data());
+    if (my_rank != num_ranks - 1)
+        ProcessTakes(recv_counts_up[2], recv_take_up.data());
+
+    if (my_rank != 0)
+        ProcessShapes(recv_counts_down[3], recv_shapes_down.data());
+    if (my_rank != num_ranks - 1)
+        ProcessShapes(recv_counts_up[3], recv_shapes_up.data());
 
-    // Free all dynamic memory used for recving
-    delete[] recv_exchange_down;
-    delete[] recv_exchange_up;
-    delete[] recv_update_down;
-    delete[] recv_update_up;
-    delete[] recv_take_down;
-    delete[] recv_take_up;
-    delete[] recv_shapes_down;
-    delete[] recv_shapes_up;
-
-    MPI_Barrier(my_sys->world);
+    // Make sure all sends are done before the send buffers are reused
+    MPI_Waitall((int)send_requests.size(), send_requests.data(), MPI_STATUSES_IGNORE);
 }
 
 void ChCommDistributed::PackExchange(BodyExchange* buf, int index) {
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "chrono/physics/ChBody.h"
 
@@ -111,9 +112,13 @@ class CH_DISTR_API ChCommDistributed {
     ///	- need to be sent to another rank to create ghosts
     /// - need to be sent to another rank to update ghosts
     ///	- need to update their comm_status
-    /// Sends updates via mpi to the appropriate rank
-    /// Processes incoming updates from other ranks
-    void Exchange();
+    /// Posts non-blocking sends of the updates to the appropriate rank.
+    /// Must be followed by CompleteExchange; work done in between overlaps the communication.
+    void PostExchange();
+
+    /// Receives the updates posted by the other ranks in PostExchange and processes them.
+    /// Waits for the completion of all sends of this rank.
+    void CompleteExchange();
 
   protected:
     ChSystemDistributed* my_sys;
@@ -161,6 +166,25 @@ class CH_DISTR_API ChCommDistributed {
     /// Packs all shapes for the body at index into buf and returns
     /// the number of shapes that it has packed.
     int PackShapes(std::vector<Shape>* buf, int index);
+
+    /// Send buffers of the exchange in progress (must persist until CompleteExchange).
+    std::vector<BodyExchange> exchange_up_buf;
+    std::vector<BodyExchange> exchange_down_buf;
+    std::vector<BodyUpdate> update_up_buf;
+    std::vector<BodyUpdate> update_down_buf;
+    std::vector<uint> update_take_up;
+    std::vector<uint> update_take_down;
+    std::vector<Shape> shapes_up;
+    std::vector<Shape> shapes_down;
+
+    /// Message counts (exchanges, updates, takes, shapes) sent to and received from each neighbor.
+    int send_counts_up[4];
+    int send_counts_down[4];
+    int recv_counts_up[4];
+    int recv_counts_down[4];
+
+    std::vector<MPI_Request> send_requests;   ///< pending sends of the exchange in progress
+    std::vector<MPI_Request> count_requests;  ///< pending receives of the message counts
 };
 /// @} distributed_comm
 
@@ -22,6 +22,8 @@
 
 #include <mpi.h>
 #include <stdlib.h>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <memory>
 
@@ -30,6 +32,7 @@ using namespace chrono;
 ChDomainDistributed::ChDomainDistributed(ChSystemDistributed* sys) {
     this->my_sys = sys;
     split_axis = 0;
+    max_shift = 0.25;
     split = false;
     axis_set = false;
 }
@@ -69,26 +72,95 @@ void ChDomainDistributed::SetSimDomain(double xlo, double xhi, double ylo, doubl
 }
 
 void ChDomainDistributed::SplitDomain() {
-    // Length of this subdomain along the long axis
-    double sub_len = (boxhi[split_axis] - boxlo[split_axis]) / my_sys->num_ranks;
+    // Equal-length sub-domains along the long axis
+    int num_ranks = my_sys->num_ranks;
+    double sub_len = (boxhi[split_axis] - boxlo[split_axis]) / num_ranks;
+
+    std::vector<double> positions(num_ranks + 1);
+    for (int i = 0; i < num_ranks; i++)
+        positions[i] = boxlo[split_axis] + i * sub_len;
+    positions[num_ranks] = boxhi[split_axis];
+
+    // Sub-domains not thicker than two ghost layers let bodies interact with ranks other than the
+    // two neighbors, which the up/down exchange does not handle.
+    double ghost_layer = my_sys->GetGhostLayer();
+    if (num_ranks > 1 && sub_len <= 2 * ghost_layer && my_sys->OnMaster()) {
+        GetLog() << "WARNING: sub-domains (" << sub_len << ") are not thicker than two ghost layers ("
+                 << 2 * ghost_layer << "). Bodies near sub-domain boundaries may not be exchanged correctly.\n";
+    }
+
+    SetSplitPositions(positions);
+    split = true;
+}
+
+void ChDomainDistributed::SetSplitPositions(const std::vector<double>& positions) {
+    int num_ranks = my_sys->num_ranks;
+    assert((int)positions.size() == num_ranks + 1);
+
+    split_pos = positions;
 
     for (int i = 0; i < 3; i++) {
         if (split_axis == i) {
-            sublo[i] = boxlo[i] + my_sys->my_rank * sub_len;
-            subhi[i] = sublo[i] + sub_len;
+            sublo[i] = split_pos[my_sys->my_rank];
+            subhi[i] = split_pos[my_sys->my_rank + 1];
         } else {
             sublo[i] = boxlo[i];
             subhi[i] = boxhi[i];
         }
     }
-    split = true;
 }
 
-int ChDomainDistributed::GetRank(ChVector<double> pos) {
-    double sub_len = subhi[split_axis] - sublo[split_axis];
-    double pt = pos[split_axis] - boxlo[split_axis];
+bool ChDomainDistributed::Rebalance(double load) {
+    // Relative load difference between two neighbor ranks below which a boundary is not moved
+    const double tolerance = 0.05;
 
-    return (int)(pt / sub_len);
+    int num_ranks = my_sys->num_ranks;
+    if (num_ranks == 1)
+        return false;
+
+    std::vector<double> loads(num_ranks);
+    MPI_Allgather(&load, 1, MPI_DOUBLE, loads.data(), 1, MPI_DOUBLE, my_sys->world);
+
+    // All ranks compute the same new boundaries from the gathered loads.
+    // A boundary moves up (enlarging the lower sub-domain) if the upper rank is more loaded.
+    double ghost_layer = my_sys->GetGhostLayer();
+    std::vector<double> positions(split_pos);
+    for (int k = 1; k < num_ranks; k++) {
+        double total = loads[k - 1] + loads[k];
+        if (total <= 0)
+            continue;
+        double imbalance = (loads[k] - loads[k - 1]) / total;
+        if (std::abs(imbalance) >= tolerance)
+            positions[k] += max_shift * ghost_layer * imbalance;
+    }
+
+    // Keep all sub-domains thicker than two ghost layers, reverting boundaries as needed
+    bool reverted = true;
+    while (reverted) {
+        reverted = false;
+        for (int i = 0; i < num_ranks; i++) {
+            if (positions[i + 1] - positions[i] > 2 * ghost_layer)
+                continue;
+            for (int k = i; k <= i + 1; k++) {
+                if (positions[k] != split_pos[k]) {
+                    positions[k] = split_pos[k];
+                    reverted = true;
+                }
+            }
+        }
+    }
+
+    if (positions == split_pos)
+        return false;
+
+    SetSplitPositions(positions);
+    return true;
+}
+
+int ChDomainDistributed::GetRank(ChVector<double> pos) {
+    // First boundary strictly above the position, clamped to the global domain
+    auto it = std::upper_bound(split_pos.begin() + 1, split_pos.end() - 1, pos[split_axis]);
+    return (int)(it - split_pos.begin()) - 1;
 }
 
 distributed::COMM_STATUS ChDomainDistributed::GetRegion(double pos) {
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "chrono/core/ChVector.h"
 #include "chrono/physics/ChBody.h"
@@ -139,6 +140,22 @@ class CH_DISTR_API ChDomainDistributed {
     /// Returns the rank which has ownership of a body with the given position
     int GetRank(ChVector<double> pos);
 
+    /// Move the sub-domain boundaries along the split axis to even out the load among ranks.
+    /// Must be called on all ranks, each providing its own load (e.g. number of bodies and contacts).
+    /// Each boundary moves toward the more loaded of its two ranks, by at most a fraction of the ghost
+    /// layer (see SetMaxBoundaryShift), so that the regular exchange migrates the affected bodies as if
+    /// they had moved. Returns true if any boundary was moved.
+    bool Rebalance(double load);
+
+    /// Set the maximum displacement of a boundary at each rebalancing, as a fraction of the ghost layer
+    /// (default: 0.25). The boundary displacement plus the distance travelled by any body during a step
+    /// must remain below the ghost layer.
+    void SetMaxBoundaryShift(double fraction) { max_shift = fraction; }
+
+    /// Return the positions, along the split axis, of the sub-domain boundaries.
+    /// Rank i owns the slab between entries i and i+1 (num_ranks + 1 values, from boxlo to boxhi).
+    const std::vector<double>& GetSplitPositions() const { return split_pos; }
+
     /// Returns true if the domain has been set.
     bool IsSplit() { return split; }
 
@@ -155,6 +172,12 @@ class CH_DISTR_API ChDomainDistributed {
 
     int split_axis;  ///< Index of the dimension of the longest edge of the global domain
 
+    std::vector<double> split_pos;  ///< Sub-domain boundaries along the split axis (num_ranks + 1 values)
+    double max_shift;               ///< Maximum boundary shift at rebalancing, as a fraction of the ghost layer
+
+    /// Set the sub-domain boundaries of all ranks and the bounds of the local sub-domain.
+    void SetSplitPositions(const std::vector<double>& positions);
+
     /// Divides the domain into equal-volume, orthogonal, axis-aligned regions along
     /// the longest axis. Needs to be called right after the system is created so that
     /// bodies are added correctly.
@@ -54,7 +54,12 @@ static void PrintNode(LocalShapeNode* node) {
 }
 
 ChSystemDistributed::ChSystemDistributed(MPI_Comm communicator, double ghostlayer, unsigned int maxobjects)
-    : ghost_layer(ghostlayer), master_rank(0), num_bodies_global(0) {
+    : ghost_layer(ghostlayer),
+      master_rank(0),
+      num_bodies_global(0),
+      balance_interval(0),
+      balance_contact_weight(1),
+      balance_counter(0) {
     MPI_Comm_dup(communicator, &world);
     MPI_Comm_size(world, &num_ranks);
     MPI_Comm_rank(world, &my_rank);
@@ -66,6 +71,7 @@ ChSystemDistributed::ChSystemDistributed(MPI_Comm communicator, double ghostlaye
     comm = new ChCommDistributed(this);
 
     data_manager->system_timer.AddTimer("Exchange");
+    data_manager->system_timer.AddTimer("Balance");
 
     // Reserve starting space
     int init = maxobjects;  // / num_ranks;
@@ -121,14 +127,31 @@ bool ChSystemDistributed::InSub(const ChVector<double>& pos) const {
     return (pos_axis >= lo - this->ghost_layer) && (pos_axis <= hi + this->ghost_layer);
 }
 
+void ChSystemDistributed::SetLoadBalancing(int interval, double contact_weight) {
+    balance_interval = interval;
+    balance_contact_weight = contact_weight;
+    balance_counter = 0;
+}
+
+double ChSystemDistributed::GetLoad() const {
+    double num_bodies = 0;
+    for (uint i = 0; i < data_manager->num_rigid_bodies; i++) {
+        distributed::COMM_STATUS status = ddm->comm_status[i];
+        if (status == distributed::OWNED || status == distributed::SHARED_UP || status == distributed::SHARED_DOWN)
+            num_bodies += 1;
+    }
+    return num_bodies + balance_contact_weight * data_manager->num_rigid_contacts;
+}
+
 bool ChSystemDistributed::Integrate_Y() {
     assert(domain->IsSplit());
     ddm->initial_add = false;
 
     bool ret = ChSystemParallelSMC::Integrate_Y();
     if (num_ranks != 1) {
+        // Wait for the messages posted in OnRigidBodiesAdvanced and process them
         data_manager->system_timer.start("Exchange");
-        comm->Exchange();
+        comm->CompleteExchange();
         data_manager->system_timer.stop("Exchange");
     }
 #ifdef DistrProfile
@@ -137,6 +160,24 @@ bool ChSystemDistributed::Integrate_Y() {
     return ret;
 }
 
+void ChSystemDistributed::OnRigidBodiesAdvanced() {
+    if (num_ranks == 1)
+        return;
+
+    // Move the sub-domain boundaries before the exchange, which then migrates the affected bodies
+    if (balance_interval > 0 && ++balance_counter >= balance_interval) {
+        data_manager->system_timer.start("Balance");
+        domain->Rebalance(GetLoad());
+        data_manager->system_timer.stop("Balance");
+        balance_counter = 0;
+    }
+
+    // Post the exchange; the body updates in ChSystemParallel::Integrate_Y overlap the communication
+    data_manager->system_timer.start("Exchange");
+    comm->PostExchange();
+    data_manager->system_timer.stop("Exchange");
+}
+
 void ChSystemDistributed::UpdateRigidBodies() {
     this->ChSystemParallel::UpdateRigidBodies();
 
@@ -77,6 +77,14 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemParallelSMC {
     /// Return the distance into the neighboring sub-domain that is considered shared.
     double GetGhostLayer() const { return ghost_layer; }
 
+    /// Enable periodic rebalancing of the sub-domains every 'interval' steps (default: 0, disabled).
+    /// The load of a rank is measured as the number of bodies it integrates plus 'contact_weight'
+    /// times its number of contacts. See ChDomainDistributed::Rebalance.
+    void SetLoadBalancing(int interval, double contact_weight = 1);
+
+    /// Return the load of this rank, as used for rebalancing the sub-domains.
+    double GetLoad() const;
+
     /// Return the current global number of bodies in the system.
     unsigned int GetNumBodiesGlobal() const { return num_bodies_global; }
 
@@ -106,8 +114,8 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemParallelSMC {
     /// that the correct body is found and removed where it exists.
     virtual void RemoveBody(std::shared_ptr<ChBody> body) override;
 
-    /// Wraps the super-class Integrate_Y call and introduces a call that carries
-    /// out all inter-rank communication.
+    /// Wraps the super-class Integrate_Y call and completes the inter-rank communication
+    /// posted during its end-of-step update.
     virtual bool Integrate_Y() override;
 
     /// Wraps super-class UpdateRigidBodies and adds a gid update.
@@ -226,6 +234,15 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemParallelSMC {
     /// Length into the neighboring sub-domain which is considered shared.
     double ghost_layer;
 
+    /// Number of steps between sub-domain rebalancing (0 if disabled).
+    int balance_interval;
+
+    /// Weight of a contact, relative to a body, in the load of a rank.
+    double balance_contact_weight;
+
+    /// Number of steps since the last sub-domain rebalancing.
+    int balance_counter;
+
     /// Number of bodies in the whole global simulation. Important for maintaining
     /// unique global IDs
     unsigned int num_bodies_global;
@@ -246,6 +263,11 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemParallelSMC {
     /// Type for internally sending contact forces
     MPI_Datatype InternalForceType;
 
+    /// Rebalances the sub-domains (if due) and posts the exchange of the bodies near the sub-domain
+    /// boundaries, as soon as their new states are known. The exchange is completed in Integrate_Y,
+    /// after the remaining end-of-step updates.
+    virtual void OnRigidBodiesAdvanced() override;
+
     friend class ChCommDistributed;
     friend class ChDomainDistributed;
 };
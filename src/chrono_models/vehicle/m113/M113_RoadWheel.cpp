@@ -20,6 +20,7 @@
 #include "chrono/utils/ChUtilsInputOutput.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/utils/ChVehicleDataCache.h"
 
 #include "chrono_models/vehicle/m113/M113_RoadWheel.h"
 
@@ -57,8 +58,7 @@ void M113_RoadWheel::CreateContactMaterial(ChContactMethod contact_method) {
 // -----------------------------------------------------------------------------
 void M113_RoadWheel::AddVisualizationAssets(VisualizationType vis) {
     if (vis == VisualizationType::MESH) {
-        auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
-        trimesh->LoadWavefrontMesh(GetMeshFile(), false, false);
+        auto trimesh = LoadMeshWavefront(GetMeshFile());
         auto trimesh_shape = chrono_types::make_shared<ChTriangleMeshShape>();
         trimesh_shape->SetMesh(trimesh);
         trimesh_shape->SetName(filesystem::path(GetMeshFile()).stem());
@@ -20,6 +20,7 @@
 #include "chrono/utils/ChUtilsInputOutput.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/utils/ChVehicleDataCache.h"
 
 #include "chrono_models/vehicle/m113/M113_TrackShoeSinglePin.h"
 
@@ -127,8 +128,7 @@ void M113_TrackShoeSinglePin::CreateContactMaterials(ChContactMethod contact_met
 // -----------------------------------------------------------------------------
 void M113_TrackShoeSinglePin::AddVisualizationAssets(VisualizationType vis) {
     if (vis == VisualizationType::MESH) {
-        auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
-        trimesh->LoadWavefrontMesh(vehicle::GetDataFile(m_meshFile), false, false);
+        auto trimesh = LoadMeshWavefront(vehicle::GetDataFile(m_meshFile));
         auto trimesh_shape = chrono_types::make_shared<ChTriangleMeshShape>();
         trimesh_shape->SetMesh(trimesh);
         trimesh_shape->SetName(filesystem::path(m_meshFile).stem());
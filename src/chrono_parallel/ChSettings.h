@@ -128,6 +128,9 @@ class solver_settings {
         max_power_iteration = 15;
         power_iter_tolerance = 0.1;
         skip_residual = 1;
+        use_mixed_precision = false;
+        mixed_precision_correction = 10;
+        sor_omega = 0.2;
     }
 
     /// The solver type variable defines name of the solver that will be used to
@@ -216,6 +219,23 @@ class solver_settings {
     real tolerance_objective;
     /// Compute residual every x iterations.
     int skip_residual;
+    /// Evaluate the Shur product of the NSC solver with single precision copies of the
+    /// constraint Jacobian (D^T and M^-1 D). Note that only the matrix values are converted:
+    /// each nonzero still stores a size_t index and, with padding, occupies as many bytes as
+    /// in double precision, so the sparse matrix traffic is not reduced; only the dense
+    /// operands of the products are halved. States, the right hand side and the Lagrange
+    /// multipliers remain in double precision. Has no effect if compute_N is set or if
+    /// Chrono::Parallel is built in single precision.
+    bool use_mixed_precision;
+    /// In mixed precision mode, the APGD, APGDREF, BB and SPGQP solvers recompute the
+    /// residual r - N*gamma with the full precision Shur product every n-th iteration
+    /// (iterative refinement), so that the rounding error of the single precision
+    /// products does not accumulate in the iterates (0: never).
+    uint mixed_precision_correction;
+    /// Relaxation factor of the projected Gauss-Seidel solver (default 0.2).
+    /// The three rows of a contact share the inverse of their averaged diagonal (3 / trace), which can
+    /// exceed the inverse of an individual diagonal entry; large values (e.g. 1) may then diverge.
+    real sor_omega;
 };
 
 /// Aggregate of all settings for Chrono::Parallel.
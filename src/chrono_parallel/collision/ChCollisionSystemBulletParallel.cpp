@@ -18,6 +18,7 @@
 // =============================================================================
 
 #include "chrono/collision/ChCollisionModelBullet.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include "chrono_parallel/collision/ChCollisionSystemBulletParallel.h"
 #include "chrono_parallel/ChDataManager.h"
@@ -110,6 +111,7 @@ void ChCollisionSystemBulletParallel::Remove(ChCollisionModel* model) {
 }
 
 void ChCollisionSystemBulletParallel::Run() {
+    CH_PROFILE_ZONE("ChCollisionSystemBulletParallel::Run");
     if (bt_collision_world) {
         bt_collision_world->performDiscreteCollisionDetection();
     }
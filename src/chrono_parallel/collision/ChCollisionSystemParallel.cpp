@@ -19,6 +19,7 @@
 
 #include "chrono_parallel/collision/ChCollisionSystemParallel.h"
 #include "chrono_parallel/collision/ChCollision.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 namespace collision {
@@ -209,6 +210,7 @@ void ChCollisionSystemParallel::Remove(ChCollisionModel* model) {
 #undef ERASE_MACRO_LEN
 
 void ChCollisionSystemParallel::Run() {
+    CH_PROFILE_ZONE("ChCollisionSystemParallel::Run");
     LOG(INFO) << "ChCollisionSystemParallel::Run()";
     if (data_manager->settings.collision.use_aabb_active) {
         body_active.resize(data_manager->num_rigid_bodies);
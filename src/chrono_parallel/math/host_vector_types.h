@@ -0,0 +1,64 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: host definitions of the CUDA vector types used by the single
+// precision math (matrixf.cuh, svd.h) and the MPM utilities, so that these can
+// be compiled by the host compiler when CUDA is not available.
+// =============================================================================
+
+#pragma once
+
+#include "chrono_parallel/ChConfigParallel.h"
+
+#ifdef CHRONO_PARALLEL_USE_CUDA
+
+#include <vector_types.h>
+#include <vector_functions.h>
+
+#else
+
+struct float2 {
+    float x, y;
+};
+
+struct float3 {
+    float x, y, z;
+};
+
+struct int3 {
+    int x, y, z;
+};
+
+static inline float2 make_float2(float x, float y) {
+    float2 t;
+    t.x = x;
+    t.y = y;
+    return t;
+}
+
+static inline float3 make_float3(float x, float y, float z) {
+    float3 t;
+    t.x = x;
+    t.y = y;
+    t.z = z;
+    return t;
+}
+
+static inline int3 make_int3(int x, int y, int z) {
+    int3 t;
+    t.x = x;
+    t.y = y;
+    t.z = z;
+    return t;
+}
+
+#endif
@@ -0,0 +1,651 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Description: multithreaded CPU implementation of the MPM solve declared in
+// ChMPM.cuh, used when Chrono::Parallel is built without CUDA. The steps follow
+// the kernels in ChMPM.cu. Particle-to-grid transfers are written as gathers:
+// markers are binned by their closest grid node and every grid node sums the
+// contributions of the markers in the surrounding bins, so each node is written
+// by a single thread and no atomics are needed.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono_parallel/math/host_vector_types.h"
+#include "chrono_parallel/physics/ChMPM.cuh"
+#include "chrono_parallel/physics/MPMUtils.h"
+
+//#define BOX_YIELD
+#define SPHERE_YIELD
+
+namespace chrono {
+
+static MPM_Settings host_settings;
+
+static float3 min_bounding_point;
+static float3 max_bounding_point;
+
+static std::vector<float> pos, vel, JE_JP;
+static std::vector<float> node_mass;
+static std::vector<float> marker_volume;
+static std::vector<float> grid_vel, delta_v;
+static std::vector<float> rhs;
+static std::vector<float> marker_Fe, marker_Fe_hat, marker_Fp;
+static std::vector<float> PolarS, PolarR;
+static std::vector<float> marker_VAP;  // per marker 3x3 term scattered to the grid (see ApplyForces, Multiply)
+
+static std::vector<float> old_vel_node_mpm;
+static std::vector<float> ml, mg, mg_p, ml_p;
+static std::vector<float> marker_plasticity;
+
+// Markers sorted by closest grid node
+static std::vector<int> marker_bin;
+static std::vector<int> bin_start;
+static std::vector<int> bin_markers;
+
+#define a_min 1e-13f
+#define a_max 1e13f
+#define neg_BB1_fallback 0.11f
+#define neg_BB2_fallback 0.12f
+
+// Call f(node, Tx, Ty, Tz) for each grid node in the two-ring of marker p,
+// with T the marker position relative to the node, in units of the bin edge.
+template <typename Func>
+static inline void ForEachNode(int p, Func f) {
+    const float bin_edge = host_settings.bin_edge;
+    const float inv_bin_edge = host_settings.inv_bin_edge;
+    const float xix = pos[p * 3 + 0];
+    const float xiy = pos[p * 3 + 1];
+    const float xiz = pos[p * 3 + 2];
+    const int cx = GridCoord(xix, inv_bin_edge, min_bounding_point.x);
+    const int cy = GridCoord(xiy, inv_bin_edge, min_bounding_point.y);
+    const int cz = GridCoord(xiz, inv_bin_edge, min_bounding_point.z);
+    for (int i = cx - 2; i <= cx + 2; ++i) {
+        for (int j = cy - 2; j <= cy + 2; ++j) {
+            for (int k = cz - 2; k <= cz + 2; ++k) {
+                int current_node = GridHash(i, j, k, host_settings.bins_per_axis_x, host_settings.bins_per_axis_y,
+                                            host_settings.bins_per_axis_z);
+                float Tx = (xix - (i * bin_edge + min_bounding_point.x)) * inv_bin_edge;
+                float Ty = (xiy - (j * bin_edge + min_bounding_point.y)) * inv_bin_edge;
+                float Tz = (xiz - (k * bin_edge + min_bounding_point.z)) * inv_bin_edge;
+                f(current_node, Tx, Ty, Tz);
+            }
+        }
+    }
+}
+
+// Call f(p, Tx, Ty, Tz) for each marker p that has grid node n in its two-ring,
+// i.e. for the markers binned in the 5x5x5 bins centered at n.
+template <typename Func>
+static inline void ForEachMarker(int n, Func f) {
+    const int3 bins_per_axis = make_int3(host_settings.bins_per_axis_x, host_settings.bins_per_axis_y,
+                                         host_settings.bins_per_axis_z);
+    const float bin_edge = host_settings.bin_edge;
+    const float inv_bin_edge = host_settings.inv_bin_edge;
+    const int3 c = GridDecode(n, bins_per_axis);
+    const float node_x = c.x * bin_edge + min_bounding_point.x;
+    const float node_y = c.y * bin_edge + min_bounding_point.y;
+    const float node_z = c.z * bin_edge + min_bounding_point.z;
+    for (int k = std::max(c.z - 2, 0); k <= std::min(c.z + 2, bins_per_axis.z - 1); ++k) {
+        for (int j = std::max(c.y - 2, 0); j <= std::min(c.y + 2, bins_per_axis.y - 1); ++j) {
+            for (int i = std::max(c.x - 2, 0); i <= std::min(c.x + 2, bins_per_axis.x - 1); ++i) {
+                const int bin = GridHash(i, j, k, bins_per_axis);
+                for (int q = bin_start[bin]; q < bin_start[bin + 1]; q++) {
+                    const int p = bin_markers[q];
+                    float Tx = (pos[p * 3 + 0] - node_x) * inv_bin_edge;
+                    float Ty = (pos[p * 3 + 1] - node_y) * inv_bin_edge;
+                    float Tz = (pos[p * 3 + 2] - node_z) * inv_bin_edge;
+                    f(p, Tx, Ty, Tz);
+                }
+            }
+        }
+    }
+}
+
+// Kernel gradient, in units of 1/length
+static inline void KernelGradient(float Tx, float Ty, float Tz, float& valx, float& valy, float& valz) {
+    const float inv_bin_edge = host_settings.inv_bin_edge;
+    valx = dN(Tx) * inv_bin_edge * N(Ty) * N(Tz);
+    valy = N(Tx) * dN(Ty) * inv_bin_edge * N(Tz);
+    valz = N(Tx) * N(Ty) * dN(Tz) * inv_bin_edge;
+}
+
+// Velocity gradient at marker p, interpolated from the given grid velocities
+static inline Mat33f VelocityGradient(int p, const std::vector<float>& v_array) {
+    Mat33f grad(0.0f);
+    ForEachNode(p, [&](int current_node, float Tx, float Ty, float Tz) {
+        float vnx = v_array[current_node * 3 + 0];
+        float vny = v_array[current_node * 3 + 1];
+        float vnz = v_array[current_node * 3 + 2];
+        float valx, valy, valz;
+        KernelGradient(Tx, Ty, Tz, valx, valy, valz);
+        grad[0] += vnx * valx; grad[1] += vny * valx; grad[2] += vnz * valx;
+        grad[3] += vnx * valy; grad[4] += vny * valy; grad[5] += vnz * valy;
+        grad[6] += vnx * valz; grad[7] += vny * valz; grad[8] += vnz * valz;
+    });
+    return grad;
+}
+
+// Scatter the per marker terms in marker_VAP to the grid: result = sum_p VAP_p * grad(N_p)
+static inline void GatherVAP(int n, float& resx, float& resy, float& resz) {
+    resx = resy = resz = 0;
+    ForEachMarker(n, [&](int p, float Tx, float Ty, float Tz) {
+        const float* VAP = &marker_VAP[p * 9];
+        float valx, valy, valz;
+        KernelGradient(Tx, Ty, Tz, valx, valy, valz);
+        resx += VAP[0] * valx + VAP[3] * valy + VAP[6] * valz;
+        resy += VAP[1] * valx + VAP[4] * valy + VAP[7] * valz;
+        resz += VAP[2] * valx + VAP[5] * valy + VAP[8] * valz;
+    });
+}
+
+static void MPM_ComputeBounds() {
+    max_bounding_point = make_float3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    min_bounding_point = make_float3(FLT_MAX, FLT_MAX, FLT_MAX);
+
+    for (int p = 0; p < host_settings.num_mpm_markers; p++) {
+        min_bounding_point.x = std::min(min_bounding_point.x, pos[p * 3 + 0]);
+        min_bounding_point.y = std::min(min_bounding_point.y, pos[p * 3 + 1]);
+        min_bounding_point.z = std::min(min_bounding_point.z, pos[p * 3 + 2]);
+        max_bounding_point.x = std::max(max_bounding_point.x, pos[p * 3 + 0]);
+        max_bounding_point.y = std::max(max_bounding_point.y, pos[p * 3 + 1]);
+        max_bounding_point.z = std::max(max_bounding_point.z, pos[p * 3 + 2]);
+    }
+
+    const float kernel_radius = host_settings.kernel_radius;
+
+    min_bounding_point.x = kernel_radius * roundf(min_bounding_point.x / kernel_radius);
+    min_bounding_point.y = kernel_radius * roundf(min_bounding_point.y / kernel_radius);
+    min_bounding_point.z = kernel_radius * roundf(min_bounding_point.z / kernel_radius);
+
+    max_bounding_point.x = kernel_radius * roundf(max_bounding_point.x / kernel_radius);
+    max_bounding_point.y = kernel_radius * roundf(max_bounding_point.y / kernel_radius);
+    max_bounding_point.z = kernel_radius * roundf(max_bounding_point.z / kernel_radius);
+
+    max_bounding_point = max_bounding_point + kernel_radius * 8;
+    min_bounding_point = min_bounding_point - kernel_radius * 6;
+
+    host_settings.bin_edge = kernel_radius * 2;
+    host_settings.inv_bin_edge = float(1.) / host_settings.bin_edge;
+
+    host_settings.bins_per_axis_x = int((max_bounding_point.x - min_bounding_point.x) * host_settings.inv_bin_edge);
+    host_settings.bins_per_axis_y = int((max_bounding_point.y - min_bounding_point.y) * host_settings.inv_bin_edge);
+    host_settings.bins_per_axis_z = int((max_bounding_point.z - min_bounding_point.z) * host_settings.inv_bin_edge);
+
+    host_settings.num_mpm_nodes =
+        host_settings.bins_per_axis_x * host_settings.bins_per_axis_y * host_settings.bins_per_axis_z;
+}
+
+// Counting sort of the markers by closest grid node. Sequential, so that the
+// order of the markers in each bin (and hence the gathered sums) is deterministic.
+static void MPM_BinMarkers() {
+    const int num_markers = host_settings.num_mpm_markers;
+    const int num_nodes = host_settings.num_mpm_nodes;
+    const float inv_bin_edge = host_settings.inv_bin_edge;
+
+    marker_bin.resize(num_markers);
+#pragma omp parallel for
+    for (int p = 0; p < num_markers; p++) {
+        int cx = GridCoord(pos[p * 3 + 0], inv_bin_edge, min_bounding_point.x);
+        int cy = GridCoord(pos[p * 3 + 1], inv_bin_edge, min_bounding_point.y);
+        int cz = GridCoord(pos[p * 3 + 2], inv_bin_edge, min_bounding_point.z);
+        cx = std::min(std::max(cx, 0), host_settings.bins_per_axis_x - 1);
+        cy = std::min(std::max(cy, 0), host_settings.bins_per_axis_y - 1);
+        cz = std::min(std::max(cz, 0), host_settings.bins_per_axis_z - 1);
+        marker_bin[p] = GridHash(cx, cy, cz, host_settings.bins_per_axis_x, host_settings.bins_per_axis_y,
+                                 host_settings.bins_per_axis_z);
+    }
+
+    bin_start.assign(num_nodes + 1, 0);
+    for (int p = 0; p < num_markers; p++) {
+        bin_start[marker_bin[p] + 1]++;
+    }
+    for (int n = 0; n < num_nodes; n++) {
+        bin_start[n + 1] += bin_start[n];
+    }
+    std::vector<int> bin_fill(bin_start.begin(), bin_start.end() - 1);
+    bin_markers.resize(num_markers);
+    for (int p = 0; p < num_markers; p++) {
+        bin_markers[bin_fill[marker_bin[p]]++] = p;
+    }
+}
+
+// Grid mass and (optionally) mass weighted grid velocity
+static void MPM_Rasterize(bool with_velocity) {
+    node_mass.resize(host_settings.num_mpm_nodes);
+    if (with_velocity) {
+        grid_vel.resize(host_settings.num_mpm_nodes * 3);
+    }
+#pragma omp parallel for
+    for (int n = 0; n < host_settings.num_mpm_nodes; n++) {
+        float n_mass = 0;
+        float mvx = 0, mvy = 0, mvz = 0;
+        ForEachMarker(n, [&](int p, float Tx, float Ty, float Tz) {
+            float weight = N(Tx) * N(Ty) * N(Tz) * host_settings.mass;
+            n_mass += weight;
+            mvx += weight * vel[p * 3 + 0];
+            mvy += weight * vel[p * 3 + 1];
+            mvz += weight * vel[p * 3 + 2];
+        });
+        node_mass[n] = n_mass;
+        if (with_velocity) {
+            if (n_mass > FLT_EPSILON) {
+                mvx /= n_mass;
+                mvy /= n_mass;
+                mvz /= n_mass;
+            }
+            grid_vel[n * 3 + 0] = mvx;
+            grid_vel[n * 3 + 1] = mvy;
+            grid_vel[n * 3 + 2] = mvz;
+        }
+    }
+}
+
+static void MPM_ComputeParticleVolumes() {
+    const float bin_edge = host_settings.bin_edge;
+#pragma omp parallel for
+    for (int p = 0; p < host_settings.num_mpm_markers; p++) {
+        float particle_density = 0;
+        ForEachNode(p, [&](int current_node, float Tx, float Ty, float Tz) {
+            particle_density += node_mass[current_node] * N(Tx) * N(Ty) * N(Tz);
+        });
+        // Inverse density to remove division
+        particle_density = (bin_edge * bin_edge * bin_edge) / particle_density;
+        marker_volume[p] = host_settings.mass * particle_density;
+    }
+}
+
+static void MPM_FeHat() {
+    const int num_markers = host_settings.num_mpm_markers;
+#pragma omp parallel for
+    for (int p = 0; p < num_markers; p++) {
+        Mat33f Fe_hat_t = VelocityGradient(p, grid_vel);
+        Mat33f m_Fe(marker_Fe.data(), p, num_markers);
+        Mat33f m_Fe_hat = (Mat33f(1.0) + host_settings.dt * Fe_hat_t) * m_Fe;
+        m_Fe_hat.Store(marker_Fe_hat.data(), p, num_markers);
+    }
+}
+
+static void MPM_ApplyForces() {
+    const int num_markers = host_settings.num_mpm_markers;
+
+    // Per marker force term, stored for the grid gather
+#pragma omp parallel for
+    for (int p = 0; p < num_markers; p++) {
+        const Mat33f FE(marker_Fe.data(), p, num_markers);
+        const Mat33f FE_hat(marker_Fe_hat.data(), p, num_markers);
+
+        const float a = -one_third;
+        const float J = Determinant(FE_hat);
+        const float Ja = powf(J, a);
+
+#if defined(BOX_YIELD) || defined(SPHERE_YIELD)
+        const float current_mu = host_settings.mu * expf(host_settings.hardening_coefficient * (marker_plasticity[p]));
+#else
+        const float current_mu = host_settings.mu;
+#endif
+
+        Mat33f JaFE = Ja * FE;
+        Mat33f UE, VE;
+        float3 EE;
+        SVD(JaFE, UE, EE, VE); /* Perform a polar decomposition, FE=RE*SE, RE is the Unitary part*/
+        Mat33f RE = MultTranspose(UE, VE);
+        Mat33f SE = VE * MultTranspose(EE, VE);
+        RE.Store(PolarR.data(), p, num_markers);
+
+        PolarS[p + 0 * num_markers] = SE[0];
+        PolarS[p + 1 * num_markers] = SE[1];
+        PolarS[p + 2 * num_markers] = SE[2];
+        PolarS[p + 3 * num_markers] = SE[4];
+        PolarS[p + 4 * num_markers] = SE[5];
+        PolarS[p + 5 * num_markers] = SE[8];
+
+        const Mat33f H = AdjointTranspose(FE_hat) * (1.0f / J);
+        const Mat33f A = 2.f * current_mu * (JaFE - RE);
+        const Mat33f Z_B = Z__B(A, FE_hat, Ja, a, H);
+        const Mat33f vPEDFepT = host_settings.dt * marker_volume[p] * MultTranspose(Z_B, FE);
+        for (int i = 0; i < 9; i++) {
+            marker_VAP[p * 9 + i] = vPEDFepT[i];
+        }
+    }
+
+#pragma omp parallel for
+    for (int n = 0; n < host_settings.num_mpm_nodes; n++) {
+        float mass = node_mass[n];
+        if (mass > 0) {
+            float fx, fy, fz;
+            GatherVAP(n, fx, fy, fz);
+            grid_vel[n * 3 + 0] -= fx / mass;
+            grid_vel[n * 3 + 1] -= fy / mass;
+            grid_vel[n * 3 + 2] -= fz / mass;
+        }
+    }
+}
+
+static void MPM_Rhs() {
+    rhs.resize(host_settings.num_mpm_nodes * 3);
+#pragma omp parallel for
+    for (int n = 0; n < host_settings.num_mpm_nodes; n++) {
+        float mass = node_mass[n];
+        if (mass > 0) {
+            rhs[n * 3 + 0] = mass * grid_vel[n * 3 + 0];
+            rhs[n * 3 + 1] = mass * grid_vel[n * 3 + 1];
+            rhs[n * 3 + 2] = mass * grid_vel[n * 3 + 2];
+        } else {
+            rhs[n * 3 + 0] = 0;
+            rhs[n * 3 + 1] = 0;
+            rhs[n * 3 + 2] = 0;
+        }
+    }
+}
+
+// output = A * input, with A the linearized implicit MPM system matrix
+static void Multiply(const std::vector<float>& input, std::vector<float>& output) {
+    const int num_markers = host_settings.num_mpm_markers;
+
+#pragma omp parallel for
+    for (int p = 0; p < num_markers; p++) {
+        Mat33f delta_F = VelocityGradient(p, input);
+
+        const Mat33f m_FE(marker_Fe.data(), p, num_markers);
+        delta_F = delta_F * m_FE;
+
+#if defined(BOX_YIELD) || defined(SPHERE_YIELD)
+        const float current_mu =
+            2.0f * host_settings.mu * expf(host_settings.hardening_coefficient * (marker_plasticity[p]));
+#else
+        const float current_mu = 2.0f * host_settings.mu;
+#endif
+
+        Mat33f RE(PolarR.data(), p, num_markers);
+
+        const Mat33f F(marker_Fe_hat.data(), p, num_markers);
+        const float a = -one_third;
+        const float J = Determinant(F);
+        const float Ja = powf(J, a);
+        const Mat33f H = AdjointTranspose(F) * (1.0f / J);
+
+        const Mat33f B_Z = B__Z(delta_F, F, Ja, a, H);
+        const Mat33f WE = TransposeMult(RE, B_Z);
+        // C is the original second derivative
+        SymMat33f SE;
+        SE[0] = PolarS[p + num_markers * 0];
+        SE[1] = PolarS[p + num_markers * 1];
+        SE[2] = PolarS[p + num_markers * 2];
+        SE[3] = PolarS[p + num_markers * 3];
+        SE[4] = PolarS[p + num_markers * 4];
+        SE[5] = PolarS[p + num_markers * 5];
+        const Mat33f C_B_Z = current_mu * (B_Z - Solve_dR(RE, SE, WE));
+
+        const Mat33f FE = Ja * F;
+        const Mat33f A = current_mu * (FE - RE);
+        const Mat33f P1 = Z__B(C_B_Z, F, Ja, a, H);
+        const Mat33f P2 = (a * DoubleDot(H, delta_F)) * Z__B(A, F, Ja, a, H);
+        const Mat33f P3 = (a * Ja * DoubleDot(A, delta_F)) * H;
+        const Mat33f P4 = (-a * Ja * DoubleDot(A, F)) * H * TransposeMult(delta_F, H);
+
+        const Mat33f VAP = marker_volume[p] * MultTranspose(P1 + P2 + P3 + P4, m_FE);
+        for (int i = 0; i < 9; i++) {
+            marker_VAP[p * 9 + i] = VAP[i];
+        }
+    }
+
+#pragma omp parallel for
+    for (int n = 0; n < host_settings.num_mpm_nodes; n++) {
+        float resx, resy, resz;
+        GatherVAP(n, resx, resy, resz);
+        float mass = node_mass[n];
+        if (mass > 0) {
+            resx += mass * input[n * 3 + 0];
+            resy += mass * input[n * 3 + 1];
+            resz += mass * input[n * 3 + 2];
+        }
+        output[n * 3 + 0] = resx;
+        output[n * 3 + 1] = resy;
+        output[n * 3 + 2] = resz;
+    }
+}
+
+static void MPM_BBSolver(const std::vector<float>& r, std::vector<float>& delta_v) {
+    const int size = (int)r.size();
+    float lastgoodres = 10e30f;
+
+    ml = delta_v;
+    mg.resize(size);
+    mg_p.resize(size);
+    ml_p.resize(size);
+
+    Multiply(ml, mg);
+#pragma omp parallel for
+    for (int i = 0; i < size; i++) {
+        mg[i] = mg[i] - r[i];
+    }
+
+    float alpha = 0.0001f;
+
+    for (int current_iteration = 0; current_iteration < host_settings.num_iterations; current_iteration++) {
+#pragma omp parallel for
+        for (int i = 0; i < size; i++) {
+            ml_p[i] = ml[i] - alpha * mg[i];
+        }
+
+        Multiply(ml_p, mg_p);
+
+        float dot_ms_ms = 0;
+        float dot_ms_my = 0;
+        float dot_my_my = 0;
+#pragma omp parallel for reduction(+ : dot_ms_ms, dot_ms_my, dot_my_my)
+        for (int i = 0; i < size; i++) {
+            mg_p[i] = mg_p[i] - r[i];
+            float ms = ml_p[i] - ml[i];
+            float my = mg_p[i] - mg[i];
+            dot_ms_ms += ms * ms;
+            dot_ms_my += ms * my;
+            dot_my_my += my * my;
+        }
+
+        if (current_iteration % 2 == 0) {
+            if (dot_ms_my <= 0) {
+                alpha = neg_BB1_fallback;
+            } else {
+                alpha = std::min(a_max, std::max(a_min, dot_ms_ms / dot_ms_my));
+            }
+        } else {
+            if (dot_ms_my <= 0) {
+                alpha = neg_BB2_fallback;
+            } else {
+                alpha = std::min(a_max, std::max(a_min, dot_ms_my / dot_my_my));
+            }
+        }
+
+        ml.swap(ml_p);
+        mg.swap(mg_p);
+
+        float dot_g_proj_norm = 0;
+#pragma omp parallel for reduction(+ : dot_g_proj_norm)
+        for (int i = 0; i < size; i++) {
+            dot_g_proj_norm += mg[i] * mg[i];
+        }
+        float g_proj_norm = sqrtf(dot_g_proj_norm);
+
+        if (g_proj_norm < lastgoodres) {
+            lastgoodres = g_proj_norm;
+            delta_v = ml;
+        }
+    }
+}
+
+static void MPM_IncrementVelocity() {
+#pragma omp parallel for
+    for (int i = 0; i < host_settings.num_mpm_nodes * 3; i++) {
+        grid_vel[i] += delta_v[i] - old_vel_node_mpm[i];
+    }
+}
+
+static void MPM_UpdateParticleVelocity() {
+    const float alpha = host_settings.alpha_flip;
+#pragma omp parallel for
+    for (int p = 0; p < host_settings.num_mpm_markers; p++) {
+        float3 V_flip = make_float3(vel[p * 3 + 0], vel[p * 3 + 1], vel[p * 3 + 2]);
+        float3 V_pic = make_float3(0.0, 0.0, 0.0);
+
+        ForEachNode(p, [&](int current_node, float Tx, float Ty, float Tz) {
+            float weight = N(Tx) * N(Ty) * N(Tz);
+
+            float vnx = grid_vel[current_node * 3 + 0];
+            float vny = grid_vel[current_node * 3 + 1];
+            float vnz = grid_vel[current_node * 3 + 2];
+
+            V_pic.x += vnx * weight;
+            V_pic.y += vny * weight;
+            V_pic.z += vnz * weight;
+            V_flip.x += (vnx - old_vel_node_mpm[current_node * 3 + 0]) * weight;
+            V_flip.y += (vny - old_vel_node_mpm[current_node * 3 + 1]) * weight;
+            V_flip.z += (vnz - old_vel_node_mpm[current_node * 3 + 2]) * weight;
+        });
+        float3 new_vel = (1.0f - alpha) * V_pic + alpha * V_flip;
+
+        float speed = Length(new_vel);
+        if (speed > host_settings.max_velocity) {
+            new_vel = new_vel * host_settings.max_velocity / speed;
+        }
+        vel[p * 3 + 0] = new_vel.x;
+        vel[p * 3 + 1] = new_vel.y;
+        vel[p * 3 + 2] = new_vel.z;
+    }
+}
+
+static void MPM_UpdateDeformationGradient() {
+    const int num_markers = host_settings.num_mpm_markers;
+#pragma omp parallel for
+    for (int p = 0; p < num_markers; p++) {
+        Mat33f vel_grad = VelocityGradient(p, grid_vel);
+
+        Mat33f delta_F = (Mat33f(1.0) + host_settings.dt * vel_grad);
+        Mat33f m_FE(marker_Fe.data(), p, num_markers);
+        Mat33f m_FPpre(marker_Fp.data(), p, num_markers);
+
+        Mat33f Fe_tmp = delta_F * m_FE;
+        Mat33f F_tmp = Fe_tmp * m_FPpre;
+        Mat33f U, V;
+        float3 E;
+        SVD(Fe_tmp, U, E, V);
+        float3 E_clamped = E;
+
+#if defined(BOX_YIELD)
+        // Simple box clamp
+        E_clamped.x = Clamp(E.x, 1.0f - host_settings.theta_c, 1.0f + host_settings.theta_s);
+        E_clamped.y = Clamp(E.y, 1.0f - host_settings.theta_c, 1.0f + host_settings.theta_s);
+        E_clamped.z = Clamp(E.z, 1.0f - host_settings.theta_c, 1.0f + host_settings.theta_s);
+        marker_plasticity[p] = fabsf(E.x * E.y * E.z - E_clamped.x * E_clamped.y * E_clamped.z);
+#elif defined(SPHERE_YIELD)
+        // Clamp to sphere (better)
+        float center = 1.0f + (host_settings.theta_s - host_settings.theta_c) * .5f;
+        float radius = (host_settings.theta_s + host_settings.theta_c) * .5f;
+        float3 offset = E - center;
+        float lent = Length(offset);
+        if (lent > radius) {
+            offset = offset * radius / lent;
+        }
+        E_clamped = offset + center;
+        marker_plasticity[p] = fabsf(E.x * E.y * E.z - E_clamped.x * E_clamped.y * E_clamped.z);
+#endif
+
+        // Inverse of Diagonal E_clamped matrix is 1/E_clamped
+        Mat33f m_FP = V * MultTranspose(Mat33f(1.0f / E_clamped), U) * F_tmp;
+        float JP_new = Determinant(m_FP);
+        // Ensure that F_p is purely deviatoric
+
+        Mat33f T1 = powf(JP_new, 1.0f / 3.0f) * U * MultTranspose(Mat33f(E_clamped), V);
+        Mat33f T2 = powf(JP_new, -1.0f / 3.0f) * m_FP;
+
+        JE_JP[p * 2 + 0] = Determinant(T1);
+        JE_JP[p * 2 + 1] = Determinant(T2);
+
+        T1.Store(marker_Fe.data(), p, num_markers);
+        T2.Store(marker_Fp.data(), p, num_markers);
+    }
+}
+
+void MPM_UpdateDeformationGradient(MPM_Settings& settings,
+                                   std::vector<float>& positions,
+                                   std::vector<float>& velocities,
+                                   std::vector<float>& jejp) {
+    host_settings = settings;
+    pos = positions;
+    vel = velocities;
+
+    MPM_ComputeBounds();
+    MPM_BinMarkers();
+    MPM_Rasterize(true);
+    MPM_UpdateDeformationGradient();
+
+    jejp = JE_JP;
+}
+
+void MPM_Solve(MPM_Settings& settings, std::vector<float>& positions, std::vector<float>& velocities) {
+    old_vel_node_mpm = grid_vel;
+
+    MPM_FeHat();
+    MPM_ApplyForces();
+    MPM_Rhs();
+
+    delta_v = old_vel_node_mpm;
+    MPM_BBSolver(rhs, delta_v);
+
+    MPM_IncrementVelocity();
+    MPM_UpdateParticleVelocity();
+
+    velocities = vel;
+}
+
+void MPM_Initialize(MPM_Settings& settings, std::vector<float>& positions) {
+    host_settings = settings;
+    pos = positions;
+    const int num_markers = host_settings.num_mpm_markers;
+
+    MPM_ComputeBounds();
+    MPM_BinMarkers();
+    vel.assign(num_markers * 3, 0);
+    MPM_Rasterize(false);
+
+    marker_volume.resize(num_markers);
+    MPM_ComputeParticleVolumes();
+
+    marker_Fe.resize(num_markers * 9);
+    marker_Fe_hat.resize(num_markers * 9);
+    marker_Fp.resize(num_markers * 9);
+    PolarR.resize(num_markers * 9);
+    PolarS.resize(num_markers * 6);
+    marker_VAP.resize(num_markers * 9);
+    JE_JP.resize(num_markers * 2);
+    marker_plasticity.assign(num_markers * 2, 0);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_markers; i++) {
+        Mat33f T(1.0f);
+        T.Store(marker_Fe.data(), i, num_markers);
+        T.Store(marker_Fp.data(), i, num_markers);
+        T.Store(PolarR.data(), i, num_markers);
+
+        PolarS[i + num_markers * 0] = 1.0f;
+        PolarS[i + num_markers * 1] = 0.0f;
+        PolarS[i + num_markers * 2] = 0.0f;
+        PolarS[i + num_markers * 3] = 1.0f;
+        PolarS[i + num_markers * 4] = 0.0f;
+        PolarS[i + num_markers * 5] = 1.0f;
+    }
+}
+
+}  // end namespace chrono
@@ -71,7 +71,6 @@ void ChParticleContainer::Update(double ChTime) {
     uint num_shafts = data_manager->num_shafts;
     uint num_motors = data_manager->num_motors;
     real3 h_gravity = data_manager->settings.step_size * mass * data_manager->settings.gravity;
-#ifdef CHRONO_PARALLEL_USE_CUDA
     if (mpm_init) {
         temp_settings.dt = (float)data_manager->settings.step_size;
         temp_settings.kernel_radius = (float)kernel_radius;
@@ -119,7 +118,6 @@ void ChParticleContainer::Update(double ChTime) {
             //            }
         }
     }
-#endif
 
     uint offset = num_rigid_bodies * 6 + num_shafts + num_motors;
 #pragma omp parallel for
@@ -295,7 +293,6 @@ void ChParticleContainer::Setup(int start_constraint) {
 }
 
 void ChParticleContainer::Initialize() {
-#ifdef CHRONO_PARALLEL_USE_CUDA
     temp_settings.dt = (float)data_manager->settings.step_size;
     temp_settings.kernel_radius = (float)kernel_radius;
     temp_settings.inv_radius = float(1.0 / kernel_radius);
@@ -326,7 +323,6 @@ void ChParticleContainer::Initialize() {
         MPM_Initialize(temp_settings, mpm_pos);
     }
     mpm_init = true;
-#endif
 }
 
 void ChParticleContainer::Build_D() {
@@ -546,7 +542,6 @@ real3 ChParticleContainer::GetBodyContactTorque(uint body_id) {
 }
 
 void ChParticleContainer::PreSolve() {
-#ifdef CHRONO_PARALLEL_USE_CUDA
     if (mpm_thread.joinable()) {
         mpm_thread.join();
 #pragma omp parallel for
@@ -557,7 +552,6 @@ void ChParticleContainer::PreSolve() {
             data_manager->host_data.v[body_offset + index * 3 + 2] = mpm_vel[p * 3 + 2];
         }
     }
-#endif
 }
 
 void ChParticleContainer::PostSolve() {}
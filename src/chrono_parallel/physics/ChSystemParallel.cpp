@@ -26,6 +26,7 @@
 
 #include "chrono/fea/ChElementTetra_4.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include "chrono_parallel/ChDataManager.h"
 #include "chrono_parallel/collision/ChCollisionModelParallel.h"
@@ -107,6 +108,7 @@ ChBodyAuxRef* ChSystemParallel::NewBodyAuxRef() {
 }
 
 bool ChSystemParallel::Integrate_Y() {
+    CH_PROFILE_ZONE("ChSystemParallel::Integrate_Y");
     LOG(INFO) << "ChSystemParallel::Integrate_Y() Time: " << ch_time;
     // Get the pointer for the system descriptor and store it into the data manager
     data_manager->system_descriptor = this->descriptor;
@@ -175,8 +177,6 @@ bool ChSystemParallel::Integrate_Y() {
             body->VariablesQbIncrementPosition(this->GetStep());
             body->VariablesQbSetSpeed(this->GetStep());
 
-            body->Update(ch_time);
-
             // update the position and rotation vectors
             pos_pointer[i] = (real3(body->GetPos().x(), body->GetPos().y(), body->GetPos().z()));
             rot_pointer[i] =
@@ -184,6 +184,15 @@ bool ChSystemParallel::Integrate_Y() {
         }
     }
 
+    OnRigidBodiesAdvanced();
+
+#pragma omp parallel for
+    for (int i = 0; i < assembly.bodylist.size(); i++) {
+        if (data_manager->host_data.active_rigid[i] != 0) {
+            assembly.bodylist[i]->Update(ch_time);
+        }
+    }
+
     uint offset = data_manager->num_rigid_bodies * 6;
     ////#pragma omp parallel for
     for (int i = 0; i < (signed)data_manager->num_shafts; i++) {
@@ -227,6 +236,14 @@ bool ChSystemParallel::Integrate_Y() {
         RecomputeThreads();
     }
 
+    // Invoke any user-provided end-of-step callbacks (after gathering contact forces, as in ChSystem)
+    if (!step_callbacks.empty()) {
+        contact_container->ComputeContactForces();
+        for (size_t ic = 0; ic < step_callbacks.size(); ic++) {
+            step_callbacks[ic]->OnEndStep(this);
+        }
+    }
+
     return true;
 }
 
@@ -426,6 +443,7 @@ void ChSystemParallel::ClearForceVariables() {
 // 8. Process bilateral constraints
 //
 void ChSystemParallel::Update() {
+    CH_PROFILE_ZONE("ChSystemParallel::Update");
     LOG(INFO) << "ChSystemParallel::Update()";
     // Clear the forces for all variables
     ClearForceVariables();
@@ -460,7 +478,9 @@ void ChSystemParallel::UpdateRigidBodies() {
     custom_vector<char>& active = data_manager->host_data.active_rigid;
     custom_vector<char>& collide = data_manager->host_data.collide_rigid;
 
-////#pragma omp parallel for
+    // Each iteration only touches the body's own data and entry i of the host arrays (as in the
+    // scatter loop at the end of Integrate_Y), so the bodies can be processed concurrently.
+#pragma omp parallel for
     for (int i = 0; i < assembly.bodylist.size(); i++) {
         auto& body = assembly.bodylist[i];
 
@@ -190,6 +190,11 @@ class CH_PARALLEL_API ChSystemParallel : public ChSystem {
 
     CollisionSystemType collision_system_type;
 
+    /// Called during the end-of-step update, once the new positions and velocities of the rigid bodies
+    /// are available in the data manager and before the bodies and the other physics items are updated.
+    /// A derived class can use it to start work (e.g., communication) that overlaps these updates.
+    virtual void OnRigidBodiesAdvanced() {}
+
   private:
     void AddShaft(std::shared_ptr<ChShaft> shaft);
 
@@ -80,9 +80,11 @@ void ChSystemParallelNSC::UpdateMaterialSurfaceData(int index, ChBody* body) {
     custom_vector<float>& friction = data_manager->host_data.sliding_friction;
     custom_vector<float>& cohesion = data_manager->host_data.cohesion;
 
-    if (body->GetCollisionModel() && body->GetCollisionModel()->GetNumShapes() > 0) {
-        auto mat =
-            std::static_pointer_cast<ChMaterialSurfaceNSC>(body->GetCollisionModel()->GetShape(0)->GetMaterial());
+    // Access the material through references, to avoid contention on the reference count of
+    // a material shared by many bodies when this function is called concurrently.
+    const auto& model = body->GetCollisionModel();
+    if (model && model->GetNumShapes() > 0) {
+        auto mat = static_cast<ChMaterialSurfaceNSC*>(model->GetShapes()[0]->GetMaterial().get());
         friction[index] = mat->GetKfriction();
         cohesion[index] = mat->GetCohesion();
     }
@@ -92,7 +92,7 @@ class CH_PARALLEL_API ChIterativeSolverParallelNSC : public ChIterativeSolverPar
     void ChangeSolverType(SolverType type);
 
   private:
-    ChShurProduct ShurProductFull;
+    ChShurProductMixed ShurProductFull;
     ChProjectConstraints ProjectFull;
 };
 
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono_parallel/solver/ChIterativeSolverParallel.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 using namespace chrono;
 
@@ -33,6 +34,7 @@ using namespace chrono;
     }
 
 void ChIterativeSolverParallelNSC::RunTimeStep() {
+    CH_PROFILE_ZONE("ChIterativeSolverParallelNSC::RunTimeStep");
     // Compute the offsets and number of constrains depending on the solver mode
     if (data_manager->settings.solver.solver_mode == SolverMode::NORMAL) {
         data_manager->rigid_rigid->offset = 1;
@@ -34,6 +34,7 @@
 
 #include "chrono/physics/ChSystemSMC.h"
 #include "chrono/physics/ChMaterialSurfaceSMC.h"
+#include "chrono/utils/ChTraceProfiler.h"
 #include "chrono_parallel/solver/ChIterativeSolverParallel.h"
 
 #if defined(CHRONO_OPENMP_ENABLED)
@@ -795,6 +796,7 @@ void ChIterativeSolverParallelSMC::ComputeR() {
 // bilateral (joint) constraints present in the system.
 // -----------------------------------------------------------------------------
 void ChIterativeSolverParallelSMC::RunTimeStep() {
+    CH_PROFILE_ZONE("ChIterativeSolverParallelSMC::RunTimeStep");
     // This is the total number of constraints, note that there are no contacts
     data_manager->num_constraints = data_manager->num_bilaterals;
     data_manager->num_unilaterals = 0;
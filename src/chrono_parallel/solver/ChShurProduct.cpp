@@ -104,6 +104,38 @@ void ChShurProduct::operator()(const DynamicVector<real>& x, DynamicVector<real>
     data_manager->system_timer.stop("ShurProduct");
 }
 
+void ChShurProductMixed::Setup(ChParallelDataManager* data_container_) {
+    ChShurProduct::Setup(data_container_);
+
+    const solver_settings& settings = data_manager->settings.solver;
+    if (!settings.use_mixed_precision || settings.compute_N || sizeof(real) == sizeof(float)) {
+        return;
+    }
+    D_T_single = data_manager->host_data.D_T;
+    M_invD_single = data_manager->host_data.M_invD;
+}
+
+void ChShurProductMixed::operator()(const DynamicVector<real>& x, DynamicVector<real>& output) {
+    const solver_settings& settings = data_manager->settings.solver;
+
+    // Full precision if mixed precision is disabled and for the partial products of the
+    // normal/sliding pre-solves. The rounding error is corrected by the solvers, which
+    // periodically recompute their residual with FullPrecision.
+    if (!settings.use_mixed_precision || settings.compute_N || sizeof(real) == sizeof(float) ||
+        settings.local_solver_mode != settings.solver_mode) {
+        ChShurProduct::operator()(x, output);
+        return;
+    }
+
+    data_manager->system_timer.start("ShurProduct");
+    x_single = x;
+    tmp_single = M_invD_single * x_single;
+    out_single = D_T_single * tmp_single;
+    output = out_single;
+    output += data_manager->host_data.E * x;
+    data_manager->system_timer.stop("ShurProduct");
+}
+
 void ChShurProductBilateral::Setup(ChParallelDataManager* data_container_) {
     ChShurProduct::Setup(data_container_);
     if (data_manager->num_bilaterals == 0) {
@@ -40,6 +40,12 @@ ChSolverParallel::ChSolverParallel() {
 
 //=================================================================================================================================
 
+bool ChSolverParallel::RefineResidual() const {
+    const solver_settings& settings = data_manager->settings.solver;
+    return settings.use_mixed_precision && settings.mixed_precision_correction > 0 &&
+           current_iteration % settings.mixed_precision_correction == 0;
+}
+
 void ChSolverParallel::ComputeSRhs(custom_vector<real>& gamma,
                                    const custom_vector<real>& rhs,
                                    custom_vector<real3>& vel_data,
@@ -66,9 +66,40 @@ class CH_PARALLEL_API ChShurProduct {
     //. Perform the Shur Product.
     virtual void operator()(const DynamicVector<real>& x, DynamicVector<real>& AX);
 
+    /// Perform the Shur Product in full precision.
+    /// Identical to the regular product, unless the product is evaluated in mixed precision.
+    virtual void FullPrecision(const DynamicVector<real>& x, DynamicVector<real>& AX) { (*this)(x, AX); }
+
     ChParallelDataManager* data_manager;  ///< Pointer to the system's data manager
 };
 
+/// Functor class for calculating the Shur product of the matrix of all constraints, optionally
+/// in mixed precision (see solver_settings::use_mixed_precision).
+/// The solvers periodically recompute their residual with FullPrecision (iterative refinement).
+class CH_PARALLEL_API ChShurProductMixed : public ChShurProduct {
+  public:
+    ChShurProductMixed() {}
+    virtual ~ChShurProductMixed() {}
+
+    /// Create the single precision copies of the Jacobian matrices, if needed.
+    virtual void Setup(ChParallelDataManager* data_container_);
+
+    /// Perform the Shur Product.
+    virtual void operator()(const DynamicVector<real>& x, DynamicVector<real>& AX);
+
+    /// Perform the Shur Product in full precision.
+    virtual void FullPrecision(const DynamicVector<real>& x, DynamicVector<real>& AX) {
+        ChShurProduct::operator()(x, AX);
+    }
+
+  private:
+    CompressedMatrix<float> D_T_single;
+    CompressedMatrix<float> M_invD_single;
+    DynamicVector<float> x_single;
+    DynamicVector<float> tmp_single;
+    DynamicVector<float> out_single;
+};
+
 /// Functor class for performing the Shur product of the matrix of bilateral constraints.
 class CH_PARALLEL_API ChShurProductBilateral : public ChShurProduct {
   public:
@@ -128,6 +159,10 @@ class CH_PARALLEL_API ChSolverParallel {
 
     real LargestEigenValue(ChShurProduct& ShurProduct, DynamicVector<real>& temp, real lambda = 0);
 
+    /// Return true if the current iteration must recompute the residual r - N*gamma with the full
+    /// precision Shur product (iterative refinement, see solver_settings::mixed_precision_correction).
+    bool RefineResidual() const;
+
     int current_iteration;  ///< The current iteration number of the solver
 
     ChConstraintRigidRigid* rigid_rigid;
@@ -296,13 +331,15 @@ class CH_PARALLEL_API ChSolverParallelJacobi : public ChSolverParallel {
     DynamicVector<real> ml_old, ml;
 };
 
-/// Gauss Seidel solver.
+/// Projected Gauss Seidel (SOR) solver.
+/// The rigid contacts are colored so that no two contacts of the same color act on the same
+/// active body; the contacts of a color are then relaxed concurrently, the colors one after the other.
 class CH_PARALLEL_API ChSolverParallelGS : public ChSolverParallel {
   public:
     ChSolverParallelGS() {}
     ~ChSolverParallelGS() {}
 
-    /// Solve using a more streamlined but harder to read version of the BB method.
+    /// Solve using the projected Gauss-Seidel method with successive over-relaxation.
     uint Solve(ChShurProduct& ShurProduct,    ///< Schur product
                ChProjectConstraints& Project, ///< Constraints
                const uint max_iter,           ///< Maximum number of iterations
@@ -310,7 +347,17 @@ class CH_PARALLEL_API ChSolverParallelGS : public ChSolverParallel {
                const DynamicVector<real>& b,  ///< Rhs vector
                DynamicVector<real>& x         ///< The vector of unknowns
                );
+
+    /// Color the contact graph of the current collision pairs.
+    void ColorContacts();
+
+    /// Return the number of colors of the last contact coloring.
+    uint GetNumColors() const { return (uint)(color_start.size() - 1); }
+
     DynamicVector<real> ml_old, ml;
+
+    std::vector<uint> color_start;     ///< offset of each color in color_contacts (num colors + 1)
+    std::vector<uint> color_contacts;  ///< contact indices, grouped by color
 };
 
 /// @} parallel_solver
@@ -141,8 +141,11 @@ uint ChSolverParallelAPGD::Solve(ChShurProduct& ShurProduct,
     gamma_hat = gamma;
 
     for (current_iteration = 0; current_iteration < (signed)max_iter; current_iteration++) {
-        ShurProduct(y, temp);
-        // ShurProduct(y, g);
+        // In mixed precision mode, periodically compute the gradient in full precision
+        if (RefineResidual())
+            ShurProduct.FullPrecision(y, temp);
+        else
+            ShurProduct(y, temp);
         g = temp - r;
         gamma_new = y - t * g;
         Project(gamma_new.data());
@@ -102,7 +102,11 @@ uint ChSolverParallelAPGDREF::Solve(ChShurProduct& ShurProduct,
     // (7) for k := 0 to N_max
     for (current_iteration = 0; current_iteration < (signed)max_iter; current_iteration++) {
         // (8) g = N * y_k - r
-        ShurProduct(y, g);
+        // In mixed precision mode, periodically compute the gradient in full precision
+        if (RefineResidual())
+            ShurProduct.FullPrecision(y, g);
+        else
+            ShurProduct(y, g);
         g = g - r;
 
         // (9) gamma_(k+1) = ProjectionOperator(y_k - t_k * g)
@@ -162,6 +162,11 @@ uint ChSolverParallelBB::Solve(ChShurProduct& ShurProduct,
         }
         // t3.stop();
         // t4.start();
+        // In mixed precision mode, periodically recompute the gradient in full precision
+        if (RefineResidual()) {
+            ShurProduct.FullPrecision(ml_p, temp);
+            mg_p = temp - r;
+        }
         ms = ml_p - ml;
         my = mg_p - mg;
         ml = ml_p;
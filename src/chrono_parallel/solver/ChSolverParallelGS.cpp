@@ -12,6 +12,9 @@
 // Authors: Hammad Mazhar
 // =============================================================================
 
+#include <climits>
+#include <numeric>
+
 #include "chrono_parallel/solver/ChSolverParallel.h"
 
 #if BLAZE_MAJOR_VERSION == 2
@@ -22,6 +25,46 @@
 
 using namespace chrono;
 
+void ChSolverParallelGS::ColorContacts() {
+    const custom_vector<vec2>& bids = data_manager->host_data.bids_rigid_rigid;
+    const custom_vector<char>& active = data_manager->host_data.active_rigid;
+    uint num_contacts = data_manager->num_rigid_contacts;
+
+    color_start.assign(1, 0);
+    color_contacts.clear();
+    color_contacts.reserve(num_contacts);
+
+    // Greedy coloring. Each pass sweeps the contacts not colored yet and gives the current color to
+    // those whose bodies were not claimed by another contact in this pass. Inactive bodies have no
+    // inverse mass and do not couple their contacts, so they are never claimed (a contact with the
+    // ground does not serialize the other ground contacts).
+    std::vector<uint> pending(num_contacts);
+    std::iota(pending.begin(), pending.end(), 0);
+    std::vector<uint> claimed(data_manager->num_rigid_bodies, UINT_MAX);
+
+    for (uint color = 0; !pending.empty(); color++) {
+        size_t num_pending = 0;
+        for (size_t k = 0; k < pending.size(); k++) {
+            uint i = pending[k];
+            int b1 = bids[i].x;
+            int b2 = bids[i].y;
+            bool free1 = !active[b1] || claimed[b1] != color;
+            bool free2 = !active[b2] || claimed[b2] != color;
+            if (free1 && free2) {
+                if (active[b1])
+                    claimed[b1] = color;
+                if (active[b2])
+                    claimed[b2] = color;
+                color_contacts.push_back(i);
+            } else {
+                pending[num_pending++] = i;
+            }
+        }
+        pending.resize(num_pending);
+        color_start.push_back((uint)color_contacts.size());
+    }
+}
+
 uint ChSolverParallelGS::Solve(ChShurProduct& ShurProduct,
                                ChProjectConstraints& Project,
                                const uint max_iter,
@@ -43,6 +86,9 @@ uint ChSolverParallelGS::Solve(ChShurProduct& ShurProduct,
     DynamicVector<real> D;
     D.resize(num_constraints, false);
 
+    ColorContacts();
+
+#pragma omp parallel for
     for (int index = 0; index < (signed)data_manager->num_rigid_contacts; index++) {
         D[index] = Nshur(index, index) + Nshur(num_contacts + index * 2 + 0, num_contacts + index * 2 + 0) +
                    Nshur(num_contacts + index * 2 + 1, num_contacts + index * 2 + 1);
@@ -80,27 +126,26 @@ uint ChSolverParallelGS::Solve(ChShurProduct& ShurProduct,
     }
     int nc = data_manager->num_rigid_contacts;
     int nfc = data_manager->num_rigid_fluid_contacts;
+    real omega = data_manager->settings.solver.sor_omega;
+    uint num_colors = GetNumColors();
+
     for (current_iteration = 0; current_iteration < (signed)max_iter; current_iteration++) {
-        real omega = .2;
         offset = 0;
 
-        for (int i = 0; i < (signed)data_manager->num_rigid_contacts; i++) {
-            ml[offset + i] = ml[offset + i] -
-                             omega * D[offset + i] * ((row(Nshur, offset + i * 1 + 0),
-                                                       blaze::subvector(ml, 0, 1 * data_manager->num_constraints)) -
-                                                      r[offset + i]);
-            ml[nc + i * 2 + 0] =
-                ml[nc + i * 2 + 0] -
-                omega * D[nc + i * 2 + 0] *
-                    ((row(Nshur, nc + i * 2 + 0), blaze::subvector(ml, 0, 1 * data_manager->num_constraints)) -
-                     r[nc + i * 2 + 0]);
-            ml[nc + i * 2 + 1] =
-                ml[nc + i * 2 + 1] -
-                omega * D[nc + i * 2 + 1] *
-                    ((row(Nshur, nc + i * 2 + 1), blaze::subvector(ml, 0, 1 * data_manager->num_constraints)) -
-                     r[nc + i * 2 + 1]);
-
-            data_manager->rigid_rigid->Project_Single(i, ml.data());
+        // Contacts of the same color share no active body, hence no off-diagonal Shur entries:
+        // they are relaxed concurrently, in Gauss-Seidel order from one color to the next.
+        for (uint c = 0; c < num_colors; c++) {
+#pragma omp parallel for
+            for (int k = (signed)color_start[c]; k < (signed)color_start[c + 1]; k++) {
+                int i = color_contacts[k];
+                int t = nc + i * 2;
+                auto gamma_all = blaze::subvector(ml, 0, num_constraints);
+                ml[offset + i] -= omega * D[offset + i] * ((row(Nshur, offset + i), gamma_all) - r[offset + i]);
+                ml[t + 0] -= omega * D[t + 0] * ((row(Nshur, t + 0), gamma_all) - r[t + 0]);
+                ml[t + 1] -= omega * D[t + 1] * ((row(Nshur, t + 1), gamma_all) - r[t + 1]);
+
+                data_manager->rigid_rigid->Project_Single(i, ml.data());
+            }
         }
 
         offset += data_manager->num_unilaterals;
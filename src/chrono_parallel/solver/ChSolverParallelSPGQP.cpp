@@ -114,6 +114,11 @@ uint ChSolverParallelSPGQP::Solve(ChShurProduct& ShurProduct,
         beta_k = Min(sigma_max, beta_tilde);
         x = x + beta_k * d_k;
         g = g + beta_k * Ad_k;
+        // The gradient is updated recursively; in mixed precision mode, periodically recompute it in full precision
+        if (RefineResidual()) {
+            ShurProduct.FullPrecision(x, temp);
+            g = temp - r;
+        }
         f_hist[current_iteration + 1] = (0.5 * (g - r, x));
         alpha = (d_k, d_k) / (Ad_k_dot_d_k);
 
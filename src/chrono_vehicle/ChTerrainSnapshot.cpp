@@ -0,0 +1,134 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Local heightfield snapshot of a terrain.
+//
+// Node (i, j) is located at (i * delta, j * delta) in the horizontal ISO plane
+// and stored at (i mod n, j mod n), so that recentering the grid leaves the
+// heights of the nodes still covered in place.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono_vehicle/ChTerrainSnapshot.h"
+#include "chrono_vehicle/ChWorldFrame.h"
+
+namespace chrono {
+namespace vehicle {
+
+static inline int Wrap(int i, int n) {
+    int k = i % n;
+    return k < 0 ? k + n : k;
+}
+
+ChTerrainSnapshot::ChTerrainSnapshot(double resolution, double size)
+    : m_terrain(nullptr), m_delta(resolution), m_i0(0), m_j0(0), m_z(0), m_valid(false), m_num_samples(0) {
+    m_n = std::max(2, (int)std::ceil(size / resolution) + 1);
+    m_heights.resize(m_n * m_n);
+}
+
+void ChTerrainSnapshot::Sample(int i, int j) {
+    ChVector<> loc = ChWorldFrame::FromISO(ChVector<>(i * m_delta, j * m_delta, m_z));
+    m_heights[Wrap(j, m_n) * m_n + Wrap(i, m_n)] = m_terrain->GetHeight(loc);
+    m_num_samples++;
+}
+
+void ChTerrainSnapshot::Update(const ChTerrain& terrain, const ChVector<>& center) {
+    if (&terrain != m_terrain) {
+        m_terrain = &terrain;
+        m_valid = false;
+    }
+
+    ChVector<> center_ISO = ChWorldFrame::ToISO(center);
+    int i0 = (int)std::floor(center_ISO.x() / m_delta) - m_n / 2;
+    int j0 = (int)std::floor(center_ISO.y() / m_delta) - m_n / 2;
+
+    if (m_valid && i0 == m_i0 && j0 == m_j0)
+        return;
+
+    if (!m_valid)
+        m_z = center_ISO.z();
+
+    // Sample the nodes not covered by the previous grid
+    for (int j = j0; j < j0 + m_n; j++) {
+        bool row_covered = m_valid && j >= m_j0 && j < m_j0 + m_n;
+        for (int i = i0; i < i0 + m_n; i++) {
+            if (row_covered && i >= m_i0 && i < m_i0 + m_n)
+                continue;
+            Sample(i, j);
+        }
+    }
+
+    m_i0 = i0;
+    m_j0 = j0;
+    m_valid = true;
+}
+
+bool ChTerrainSnapshot::Locate(const ChVector<>& loc, int& i, int& j, double& tx, double& ty) const {
+    if (!m_valid)
+        return false;
+
+    ChVector<> loc_ISO = ChWorldFrame::ToISO(loc);
+    double x = loc_ISO.x() / m_delta - m_i0;
+    double y = loc_ISO.y() / m_delta - m_j0;
+    if (x < 0 || y < 0 || x > m_n - 1 || y > m_n - 1)
+        return false;
+
+    int ci = std::min((int)x, m_n - 2);
+    int cj = std::min((int)y, m_n - 2);
+    tx = x - ci;
+    ty = y - cj;
+    i = m_i0 + ci;
+    j = m_j0 + cj;
+    return true;
+}
+
+double ChTerrainSnapshot::Node(int i, int j) const {
+    return m_heights[Wrap(j, m_n) * m_n + Wrap(i, m_n)];
+}
+
+double ChTerrainSnapshot::GetHeight(const ChVector<>& loc) const {
+    int i, j;
+    double tx, ty;
+    if (!Locate(loc, i, j, tx, ty))
+        return m_terrain ? m_terrain->GetHeight(loc) : ChTerrain::GetHeight(loc);
+
+    double h0 = (1 - tx) * Node(i, j) + tx * Node(i + 1, j);
+    double h1 = (1 - tx) * Node(i, j + 1) + tx * Node(i + 1, j + 1);
+    return (1 - ty) * h0 + ty * h1;
+}
+
+ChVector<> ChTerrainSnapshot::GetNormal(const ChVector<>& loc) const {
+    int i, j;
+    double tx, ty;
+    if (!Locate(loc, i, j, tx, ty))
+        return m_terrain ? m_terrain->GetNormal(loc) : ChTerrain::GetNormal(loc);
+
+    double h00 = Node(i, j);
+    double h10 = Node(i + 1, j);
+    double h01 = Node(i, j + 1);
+    double h11 = Node(i + 1, j + 1);
+    double dhdx = ((1 - ty) * (h10 - h00) + ty * (h11 - h01)) / m_delta;
+    double dhdy = ((1 - tx) * (h01 - h00) + tx * (h11 - h10)) / m_delta;
+
+    ChVector<> normal_ISO(-dhdx, -dhdy, 1);
+    return ChWorldFrame::FromISO(normal_ISO.GetNormalized());
+}
+
+float ChTerrainSnapshot::GetCoefficientFriction(const ChVector<>& loc) const {
+    return m_terrain ? m_terrain->GetCoefficientFriction(loc) : ChTerrain::GetCoefficientFriction(loc);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,97 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Local heightfield snapshot of a terrain, for cheap repeated height queries
+// around a moving point (e.g. a wheel).
+//
+// =============================================================================
+
+#ifndef CH_TERRAIN_SNAPSHOT_H
+#define CH_TERRAIN_SNAPSHOT_H
+
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/ChTerrain.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_terrain
+/// @{
+
+/// Local heightfield snapshot of a terrain.
+/// The snapshot samples the heights of a source terrain on a square grid centered at a given point and
+/// answers height and normal queries within the grid by bilinear interpolation (normals are obtained from
+/// the gradient of the interpolated heights). Queries outside the grid are forwarded to the source terrain.
+///
+/// Grid nodes are fixed in space (aligned with multiples of the resolution in the horizontal ISO plane), so
+/// moving the grid only samples the nodes not covered before. A snapshot is therefore only valid for terrains
+/// whose height does not change in time (e.g. RigidTerrain, CRGTerrain); call Invalidate after a change.
+class CH_VEHICLE_API ChTerrainSnapshot : public ChTerrain {
+  public:
+    /// Construct a snapshot with the given grid spacing and (approximate) side length.
+    ChTerrainSnapshot(double resolution, double size);
+
+    ~ChTerrainSnapshot() {}
+
+    /// Center the grid at the specified location, sampling the source terrain at the new grid nodes.
+    /// The entire grid is resampled if the source terrain differs from the one used in the previous update.
+    void Update(const ChTerrain& terrain, const ChVector<>& center);
+
+    /// Discard all sampled heights (the next update resamples the entire grid).
+    void Invalidate() { m_valid = false; }
+
+    /// Get the terrain height below the specified location.
+    virtual double GetHeight(const ChVector<>& loc) const override;
+
+    /// Get the terrain normal at the point below the specified location.
+    virtual ChVector<> GetNormal(const ChVector<>& loc) const override;
+
+    /// Get the coefficient of friction of the source terrain at the point below the specified location.
+    virtual float GetCoefficientFriction(const ChVector<>& loc) const override;
+
+    /// Return the grid spacing.
+    double GetResolution() const { return m_delta; }
+
+    /// Return the number of grid nodes in each direction.
+    int GetGridSize() const { return m_n; }
+
+    /// Return the total number of source terrain height queries performed so far.
+    size_t GetNumSamples() const { return m_num_samples; }
+
+  private:
+    /// Locate a point on the grid. Return false if the point is outside the grid.
+    bool Locate(const ChVector<>& loc, int& i, int& j, double& tx, double& ty) const;
+
+    /// Height at the grid node with the given global indices (must be inside the grid).
+    double Node(int i, int j) const;
+
+    void Sample(int i, int j);
+
+    const ChTerrain* m_terrain;  ///< source terrain
+    double m_delta;              ///< grid spacing
+    int m_n;                     ///< number of nodes in each direction
+    int m_i0;                    ///< global index of the first node in x direction
+    int m_j0;                    ///< global index of the first node in y direction
+    double m_z;                  ///< ISO height of the sampling points
+    bool m_valid;                ///< true if the grid holds sampled heights
+    std::vector<double> m_heights;  ///< node heights, stored with periodic (wrap-around) indexing
+    size_t m_num_samples;
+};
+
+/// @} vehicle_terrain
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -16,7 +16,9 @@
 //
 // =============================================================================
 
-#include "chrono/physics/ChSystem.h"
+#include <cmath>
+
+#include "chrono/physics/ChSystemNSC.h"
 
 #include "chrono_vehicle/powertrain/ChShaftsPowertrain.h"
 
@@ -29,7 +31,13 @@ namespace vehicle {
 // ChShaftsBody could transfer rolling torque to the chassis.
 // -----------------------------------------------------------------------------
 ChShaftsPowertrain::ChShaftsPowertrain(const std::string& name, const ChVector<>& dir_motor_block)
-    : ChPowertrain(name), m_dir_motor_block(dir_motor_block), m_last_time_gearshift(0), m_gear_shift_latency(0.5) {}
+    : ChPowertrain(name),
+      m_dir_motor_block(dir_motor_block),
+      m_last_time_gearshift(0),
+      m_gear_shift_latency(0.5),
+      m_subcycle_step(0),
+      m_output_torque(0),
+      m_chassis_torque(0) {}
 
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
@@ -38,6 +46,61 @@ void ChShaftsPowertrain::Initialize(std::shared_ptr<ChChassis> chassis, std::sha
 
     assert(chassis->GetBody()->GetSystem());
     ChSystem* my_system = chassis->GetBody()->GetSystem();
+    std::shared_ptr<ChBody> truss_body = chassis->GetBody();
+    std::shared_ptr<ChShaft> output_shaft = driveline->GetDriveshaft();
+
+    // If subcycled, create the shafts in a separate system, with proxies for the chassis (fixed)
+    // and for the driveshaft (with speed imposed at each synchronization).
+    // The reaction torque on the chassis proxy is transferred to the vehicle chassis through a
+    // proxy of the motor block, connected to the chassis in the vehicle system.
+    // The ingear shaft, rigidly coupled to the driveshaft by the gearbox, is represented in the
+    // vehicle system by a proxy with the same inertia, so that its inertia torque is applied
+    // implicitly (an explicit transfer of this torque is unstable).
+    if (m_subcycle_step > 0) {
+        m_motorblock_proxy = chrono_types::make_shared<ChShaft>();
+        m_motorblock_proxy->SetInertia(GetMotorBlockInertia());
+        my_system->Add(m_motorblock_proxy);
+
+        m_motorblock_proxy_to_body = chrono_types::make_shared<ChShaftsBody>();
+        m_motorblock_proxy_to_body->Initialize(m_motorblock_proxy, truss_body, m_dir_motor_block);
+        my_system->Add(m_motorblock_proxy_to_body);
+
+        m_ingear_proxy = chrono_types::make_shared<ChShaft>();
+        m_ingear_proxy->SetInertia(GetIngearShaftInertia());
+        my_system->Add(m_ingear_proxy);
+
+        m_ingear_proxy_gears = chrono_types::make_shared<ChShaftsGearbox>();
+        m_ingear_proxy_gears->Initialize(m_ingear_proxy, output_shaft, truss_body, m_dir_motor_block);
+        my_system->Add(m_ingear_proxy_gears);
+
+        m_subsystem = chrono_types::make_shared<ChSystemNSC>();
+        m_subsystem->SetChTime(my_system->GetChTime());
+
+        truss_body = chrono_types::make_shared<ChBody>();
+        truss_body->SetBodyFixed(true);
+        m_subsystem->AddBody(truss_body);
+
+        auto truss_shaft = chrono_types::make_shared<ChShaft>();
+        truss_shaft->SetShaftFixed(true);
+        m_subsystem->Add(truss_shaft);
+
+        // Note: the proxy inertia does not affect the transmitted torque (the proxy speed is imposed)
+        double speed = driveline->GetDriveshaftSpeed();
+        m_output_shaft = chrono_types::make_shared<ChShaft>();
+        m_output_shaft->SetInertia(GetIngearShaftInertia());
+        m_output_shaft->SetPos_dt(speed);
+        m_subsystem->Add(m_output_shaft);
+
+        m_output_speed = chrono_types::make_shared<ChFunction_Const>(speed);
+        m_output_motor = chrono_types::make_shared<ChShaftsMotorSpeed>();
+        m_output_motor->Initialize(m_output_shaft, truss_shaft);
+        m_output_motor->SetSpeedFunction(m_output_speed);
+        m_output_motor->SetAvoidAngleDrift(false);
+        m_subsystem->Add(m_output_motor);
+
+        my_system = m_subsystem.get();
+        output_shaft = m_output_shaft;
+    }
 
     // Cache the upshift and downshift speeds (in rad/s)
     m_upshift_speed = GetUpshiftRPM() * CH_C_2PI / 60.0;
@@ -63,7 +126,7 @@ void ChShaftsPowertrain::Initialize(std::shared_ptr<ChChassis> chassis, std::sha
     // represents the chassis. This allows to get the effect of the car 'rolling'
     // when the longitudinal engine accelerates suddenly.
     m_motorblock_to_body = chrono_types::make_shared<ChShaftsBody>();
-    m_motorblock_to_body->Initialize(m_motorblock, chassis->GetBody(), m_dir_motor_block);
+    m_motorblock_to_body->Initialize(m_motorblock, truss_body, m_dir_motor_block);
     my_system->Add(m_motorblock_to_body);
 
     // CREATE  a 1 d.o.f. object: a 'shaft' with rotational inertia.
@@ -118,7 +181,7 @@ void ChShaftsPowertrain::Initialize(std::shared_ptr<ChChassis> chassis, std::sha
     // shafts. Note that differently from the basic ChShaftsGear, this also provides
     // the possibility of transmitting a reaction torque to the box (the truss).
     m_gears = chrono_types::make_shared<ChShaftsGearbox>();
-    m_gears->Initialize(m_shaft_ingear, driveline->GetDriveshaft(), chassis->GetBody(), m_dir_motor_block);
+    m_gears->Initialize(m_shaft_ingear, output_shaft, truss_body, m_dir_motor_block);
     m_gears->SetTransmissionRatio(m_gear_ratios[m_current_gear]);
     my_system->Add(m_gears);
 
@@ -136,7 +199,15 @@ void ChShaftsPowertrain::SetSelectedGear(int igear) {
 
     m_current_gear = igear;
     if (m_gears)
-        m_gears->SetTransmissionRatio(m_gear_ratios[igear]);
+        SetTransmissionRatio(m_gear_ratios[igear]);
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+void ChShaftsPowertrain::SetTransmissionRatio(double ratio) {
+    m_gears->SetTransmissionRatio(ratio);
+    if (m_ingear_proxy_gears)
+        m_ingear_proxy_gears->SetTransmissionRatio(ratio);
 }
 
 // -----------------------------------------------------------------------------
@@ -155,7 +226,7 @@ void ChShaftsPowertrain::SetDriveMode(ChPowertrain::DriveMode mmode) {
             SetSelectedGear(1);
             break;
         case NEUTRAL:
-            m_gears->SetTransmissionRatio(1e20);
+            SetTransmissionRatio(1e20);
             break;
         case REVERSE:
             SetSelectedGear(0);
@@ -168,6 +239,18 @@ void ChShaftsPowertrain::SetDriveMode(ChPowertrain::DriveMode mmode) {
 void ChShaftsPowertrain::Synchronize(double time, double throttle) {
     double shaft_speed = m_driveline->GetDriveshaftSpeed();
 
+    // If subcycled, impose the current driveshaft speed on the proxy shaft and apply the
+    // chassis reaction torque averaged over the last substeps (as done for the output torque).
+    // The speeds of the shafts coupled by the gearbox are set directly, so that the speed change
+    // does not produce an inertia torque in the powertrain system (see Initialize).
+    if (m_subsystem) {
+        m_output_speed->Set_yconst(shaft_speed);
+        m_output_shaft->SetPos_dt(shaft_speed);
+        m_shaft_ingear->SetPos_dt(shaft_speed / m_gears->GetTransmissionRatio());
+        // The proxy constraint reaction on the chassis balances the torque applied to the proxy
+        m_motorblock_proxy->SetAppliedTorque(-m_chassis_torque);
+    }
+
     // Just update the throttle level in the thermal engine
     m_engine->SetThrottle(throttle);
 
@@ -198,5 +281,51 @@ void ChShaftsPowertrain::Synchronize(double time, double throttle) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+double ChShaftsPowertrain::GetDriveshaftTorque() const {
+    if (m_subsystem)
+        return m_output_torque + m_ingear_proxy_gears->GetTorqueReactionOn2();
+    return m_gears->GetTorqueReactionOn2();
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+ChVector<> ChShaftsPowertrain::GetChassisReactionTorque() const {
+    if (m_subsystem)
+        return m_motorblock_proxy_to_body->GetTorqueReactionOnBody() +
+               m_ingear_proxy_gears->GetTorqueReactionOnBody();
+    return m_motorblock_to_body->GetTorqueReactionOnBody() + m_gears->GetTorqueReactionOnBody();
+}
+
+// -----------------------------------------------------------------------------
+// If subcycled, advance the powertrain system with substeps not larger than the
+// specified subcycling step and average the torques transmitted to the driveshaft
+// and to the chassis (motor block and gearbox reactions on the chassis proxy).
+// -----------------------------------------------------------------------------
+void ChShaftsPowertrain::Advance(double step) {
+    if (!m_subsystem)
+        return;
+
+    int num_substeps = static_cast<int>(std::ceil(step / m_subcycle_step - 1e-10));
+    if (num_substeps < 1)
+        num_substeps = 1;
+    double substep = step / num_substeps;
+
+    // The torque applied by the gearbox to the proxy shaft balances the motor torque.
+    // The reactions on the chassis proxy act along the motor block direction.
+    ChVector<> dir = Vnorm(m_dir_motor_block);
+    double torque = 0;
+    double chassis_torque = 0;
+    for (int i = 0; i < num_substeps; i++) {
+        m_subsystem->DoStepDynamics(substep);
+        torque -= m_output_motor->GetMotorTorque();
+        chassis_torque +=
+            Vdot(m_motorblock_to_body->GetTorqueReactionOnBody() + m_gears->GetTorqueReactionOnBody(), dir);
+    }
+    m_output_torque = torque / num_substeps;
+    m_chassis_torque = chassis_torque / num_substeps;
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
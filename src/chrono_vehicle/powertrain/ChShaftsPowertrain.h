@@ -33,6 +33,8 @@
 #include "chrono/physics/ChShaftsMotor.h"
 #include "chrono/physics/ChShaftsTorque.h"
 #include "chrono/physics/ChShaftsThermalEngine.h"
+#include "chrono/physics/ChShaftsMotorSpeed.h"
+#include "chrono/physics/ChSystem.h"
 
 namespace chrono {
 namespace vehicle {
@@ -75,9 +77,32 @@ class CH_VEHICLE_API ChShaftsPowertrain : public ChPowertrain {
     /// Return the output torque from the powertrain.
     /// This is the torque that is passed to a vehicle system, thus providing the
     /// interface between the powertrain and vehicle co-simulation modules.
-    /// Since a ShaftsPowertrain is directly connected to the vehicle's driveline,
-    /// this function returns 0.
-    virtual double GetOutputTorque() const override { return 0; }
+    /// If not subcycled, a ShaftsPowertrain is directly connected to the vehicle's driveline
+    /// and this function returns 0. Otherwise, it returns the output torque averaged over the
+    /// substeps of the last call to Advance.
+    virtual double GetOutputTorque() const override { return m_subsystem ? m_output_torque : 0; }
+
+    /// Enable subcycling of the powertrain shafts with the specified step size (default: 0, no subcycling).
+    /// If enabled, the powertrain shafts are not added to the vehicle system but to a separate system
+    /// which is advanced with substeps not larger than 'step' at each vehicle step. The two systems are
+    /// coupled through the driveshaft: the vehicle driveshaft speed is imposed (constant over a vehicle
+    /// step) on a proxy shaft in the powertrain system, and the resulting output torque is applied to the
+    /// vehicle driveline. The motor block and gearbox are attached to a fixed proxy of the chassis; their
+    /// reaction torque, averaged over the substeps, is applied to the vehicle chassis through a proxy of
+    /// the motor block. The inertia of the ingear shaft is accounted for in the vehicle system.
+    /// Must be called before initialization.
+    void SetSubcycling(double step) { m_subcycle_step = step; }
+
+    /// Return true if the powertrain shafts are subcycled.
+    bool IsSubcycled() const { return m_subsystem != nullptr; }
+
+    /// Return the torque applied by the gearbox to the driveshaft.
+    /// If subcycled, this includes the output torque averaged over the substeps of the last call to Advance.
+    double GetDriveshaftTorque() const;
+
+    /// Return the reaction torque applied by the powertrain (motor block and gearbox) on the chassis.
+    /// The torque is expressed in the chassis reference frame.
+    ChVector<> GetChassisReactionTorque() const;
 
     /// Use this function to set the mode of automatic transmission.
     virtual void SetDriveMode(ChPowertrain::DriveMode mmode) override;
@@ -136,9 +161,12 @@ class CH_VEHICLE_API ChShaftsPowertrain : public ChPowertrain {
                              ) override;
 
     /// Advance the state of this powertrain system by the specified time step.
-    /// Since the state of a ShaftsPowertrain is advanced as part of the vehicle
-    /// state, this function does nothing.
-    virtual void Advance(double step) override {}
+    /// If not subcycled, the state of a ShaftsPowertrain is advanced as part of the vehicle
+    /// state and this function does nothing.
+    virtual void Advance(double step) override;
+
+    /// Set the transmission ratio of the gearbox (and of its proxy, if subcycled).
+    void SetTransmissionRatio(double ratio);
 
     std::shared_ptr<ChShaftsBody> m_motorblock_to_body;
     std::shared_ptr<ChShaft> m_motorblock;
@@ -158,6 +186,18 @@ class CH_VEHICLE_API ChShaftsPowertrain : public ChPowertrain {
     double m_gear_shift_latency;
     double m_upshift_speed;
     double m_downshift_speed;
+
+    double m_subcycle_step;                            ///< maximum substep (0 if not subcycled)
+    std::shared_ptr<ChSystem> m_subsystem;             ///< separate system for the powertrain shafts (if subcycled)
+    std::shared_ptr<ChShaft> m_output_shaft;           ///< proxy for the vehicle driveshaft (if subcycled)
+    std::shared_ptr<ChShaftsMotorSpeed> m_output_motor;  ///< imposes the driveshaft speed on the proxy shaft
+    std::shared_ptr<ChFunction_Const> m_output_speed;  ///< driveshaft speed over the current vehicle step
+    std::shared_ptr<ChShaft> m_motorblock_proxy;       ///< proxy for the motor block in the vehicle system
+    std::shared_ptr<ChShaftsBody> m_motorblock_proxy_to_body;  ///< connects the motor block proxy to the chassis
+    std::shared_ptr<ChShaft> m_ingear_proxy;           ///< proxy for the ingear shaft in the vehicle system
+    std::shared_ptr<ChShaftsGearbox> m_ingear_proxy_gears;  ///< couples the ingear proxy to the driveshaft
+    double m_output_torque;                            ///< output torque averaged over the last substeps
+    double m_chassis_torque;                           ///< chassis reaction torque averaged over the last substeps
 };
 
 /// @} vehicle_powertrain
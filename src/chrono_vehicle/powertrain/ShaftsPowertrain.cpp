@@ -82,6 +82,11 @@ void ShaftsPowertrain::Create(const rapidjson::Document& d) {
     assert(d.HasMember("Torque Converter"));
     ReadMapData(d["Torque Converter"]["Capacity Factor Map"], m_tc_capacity_factor);
     ReadMapData(d["Torque Converter"]["Torque Ratio Map"], m_tc_torque_ratio);
+
+    // Read optional subcycling step
+    if (d.HasMember("Subcycling Step")) {
+        SetSubcycling(d["Subcycling Step"].GetDouble());
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -19,6 +19,8 @@
 //
 // =============================================================================
 
+#include "chrono/utils/ChTraceProfiler.h"
+
 #include "chrono_vehicle/ChSubsysDefs.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackedVehicle.h"
 
@@ -75,6 +77,7 @@ void ChTrackedVehicle::Synchronize(double time,
                                    const ChDriver::Inputs& driver_inputs,
                                    const TerrainForces& shoe_forces_left,
                                    const TerrainForces& shoe_forces_right) {
+    CH_PROFILE_ZONE("ChTrackedVehicle::Synchronize");
     double powertrain_torque = 0;
     if (m_powertrain) {
         // Extract the torque from the powertrain.
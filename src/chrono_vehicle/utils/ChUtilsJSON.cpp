@@ -19,6 +19,7 @@
 #include <fstream>
 
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
+#include "chrono_vehicle/utils/ChVehicleDataCache.h"
 
 #include "chrono_vehicle/chassis/RigidChassis.h"
 
@@ -90,8 +91,7 @@ namespace vehicle {
 
 // -----------------------------------------------------------------------------
 
-Document ReadFileJSON(const std::string& filename) {
-    Document d;
+static void ParseFileJSON(const std::string& filename, Document& d) {
     std::ifstream ifs(filename);
     if (!ifs.good()) {
         GetLog() << "ERROR: Could not open JSON file: " << filename << "\n";
@@ -102,6 +102,26 @@ Document ReadFileJSON(const std::string& filename) {
             GetLog() << "ERROR: Invalid JSON file: " << filename << "\n";
         }
     }
+}
+
+Document ReadFileJSON(const std::string& filename) {
+    Document d;
+    if (!IsDataCacheEnabled()) {
+        ParseFileJSON(filename, d);
+        return d;
+    }
+
+    // Parse the file only once; each caller gets its own deep copy of the cached document
+    auto cached = FindCachedJSON(filename);
+    if (!cached) {
+        auto parsed = std::make_shared<Document>();
+        ParseFileJSON(filename, *parsed);
+        if (parsed->IsNull())
+            return d;
+        CacheJSON(filename, parsed);
+        cached = parsed;
+    }
+    d.CopyFrom(*cached, d.GetAllocator());
     return d;
 }
 
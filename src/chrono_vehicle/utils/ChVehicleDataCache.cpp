@@ -0,0 +1,96 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Process-wide cache of vehicle data files.
+//
+// Files are loaded outside the lock, so that concurrent threads creating
+// vehicles do not serialize on file IO. Two threads missing on the same file
+// may both load it; the first one to finish populates the cache.
+//
+// =============================================================================
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#include "chrono_vehicle/utils/ChVehicleDataCache.h"
+
+namespace chrono {
+namespace vehicle {
+
+static std::atomic<bool> cache_enabled(false);
+static std::mutex cache_mutex;
+static std::unordered_map<std::string, std::shared_ptr<const rapidjson::Document>> json_cache;
+static std::unordered_map<std::string, std::shared_ptr<geometry::ChTriangleMeshConnected>> mesh_cache;
+
+void EnableDataCache(bool val) {
+    cache_enabled = val;
+}
+
+bool IsDataCacheEnabled() {
+    return cache_enabled;
+}
+
+void ClearDataCache() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    json_cache.clear();
+    mesh_cache.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+std::shared_ptr<geometry::ChTriangleMeshConnected> LoadMeshWavefront(const std::string& filename,
+                                                                    bool load_normals,
+                                                                    bool load_uv) {
+    if (!cache_enabled) {
+        auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
+        trimesh->LoadWavefrontMesh(filename, load_normals, load_uv);
+        return trimesh;
+    }
+
+    std::string key = filename + (load_normals ? "|n" : "|") + (load_uv ? "t" : "");
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        auto it = mesh_cache.find(key);
+        if (it != mesh_cache.end())
+            return it->second;
+    }
+
+    auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
+    if (!trimesh->LoadWavefrontMesh(filename, load_normals, load_uv))
+        return trimesh;  // do not cache failed loads
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return mesh_cache.emplace(key, trimesh).first->second;
+}
+
+// -----------------------------------------------------------------------------
+
+std::shared_ptr<const rapidjson::Document> FindCachedJSON(const std::string& filename) {
+    if (!cache_enabled)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto it = json_cache.find(filename);
+    return (it != json_cache.end()) ? it->second : nullptr;
+}
+
+void CacheJSON(const std::string& filename, std::shared_ptr<const rapidjson::Document> doc) {
+    if (!cache_enabled)
+        return;
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    json_cache.emplace(filename, doc);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,72 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Process-wide cache of vehicle data files (parsed JSON specification files and
+// Wavefront OBJ meshes), shared by all vehicle instances created while the
+// cache is enabled.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_DATA_CACHE_H
+#define CH_VEHICLE_DATA_CACHE_H
+
+#include <memory>
+#include <string>
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+#include "chrono_thirdparty/rapidjson/document.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_utils
+/// @{
+
+/// Enable or disable the vehicle data cache (default: disabled).
+/// While enabled, every JSON specification file is parsed only once (ReadFileJSON returns a copy of
+/// the cached document) and every OBJ mesh is loaded only once and shared by all visualization
+/// assets that reference it. Enable the cache before creating many instances of the same vehicle.
+/// Disabling the cache does not release the cached data; use ClearDataCache for that.
+CH_VEHICLE_API void EnableDataCache(bool val);
+
+/// Return true if the vehicle data cache is enabled.
+CH_VEHICLE_API bool IsDataCacheEnabled();
+
+/// Release all cached JSON documents and meshes.
+/// Meshes still referenced by existing vehicles remain valid.
+CH_VEHICLE_API void ClearDataCache();
+
+/// Load a triangle mesh from the specified Wavefront OBJ file.
+/// If the data cache is enabled, the returned mesh is shared with all other callers requesting the same
+/// file (with the same flags) and must not be modified; copy it first if it needs to be transformed.
+/// Otherwise, a new mesh is loaded from file.
+CH_VEHICLE_API std::shared_ptr<geometry::ChTriangleMeshConnected> LoadMeshWavefront(const std::string& filename,
+                                                                                   bool load_normals = false,
+                                                                                   bool load_uv = false);
+
+/// Return the cached JSON document for the specified file, or an empty pointer if not cached.
+/// Used by ReadFileJSON.
+CH_VEHICLE_API std::shared_ptr<const rapidjson::Document> FindCachedJSON(const std::string& filename);
+
+/// Add a parsed JSON document to the cache (if the cache is enabled).
+/// Used by ReadFileJSON.
+CH_VEHICLE_API void CacheJSON(const std::string& filename, std::shared_ptr<const rapidjson::Document> doc);
+
+/// @} vehicle_utils
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
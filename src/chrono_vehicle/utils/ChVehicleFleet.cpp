@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batch runner for many independent vehicle simulations.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iomanip>
+#include <ostream>
+#include <thread>
+
+#include "chrono/core/ChTimer.h"
+
+#include "chrono_vehicle/utils/ChVehicleFleet.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+
+ChFleetMember::ChFleetMember() : m_num_steps(0), m_wall_time(0), m_thread(-1), m_failed(false) {}
+
+// -----------------------------------------------------------------------------
+
+ChWheeledFleetMember::ChWheeledFleetMember(std::shared_ptr<ChWheeledVehicle> vehicle,
+                                           std::shared_ptr<ChTerrain> terrain,
+                                           std::shared_ptr<ChDriver> driver)
+    : m_vehicle(vehicle), m_terrain(terrain), m_driver(driver) {}
+
+void ChWheeledFleetMember::ExecuteStep(double step) {
+    double time = m_vehicle->GetChTime();
+
+    // Driver inputs
+    ChDriver::Inputs driver_inputs = m_driver->GetInputs();
+
+    // Update modules (process inputs from other modules)
+    m_driver->Synchronize(time);
+    m_terrain->Synchronize(time);
+    m_vehicle->Synchronize(time, driver_inputs, *m_terrain);
+
+    // Advance simulation for one timestep for all modules
+    m_driver->Advance(step);
+    m_terrain->Advance(step);
+    m_vehicle->Advance(step);
+}
+
+// -----------------------------------------------------------------------------
+
+ChVehicleFleet::ChVehicleFleet() : m_wall_time(0) {
+    m_num_threads = std::max(1, (int)std::thread::hardware_concurrency());
+}
+
+void ChVehicleFleet::RunMember(ChFleetMember& member, int thread, double end_time, double step) {
+    member.m_num_steps = 0;
+    member.m_thread = thread;
+    member.m_failed = false;
+    member.m_error.clear();
+
+    ChTimer<double> timer;
+    timer.reset();
+    timer.start();
+    try {
+        // Stop half a step early, so that round-off does not add an extra step
+        while (member.GetChTime() < end_time - 0.5 * step && !member.IsDone()) {
+            member.ExecuteStep(step);
+            member.m_num_steps++;
+        }
+    } catch (const std::exception& e) {
+        member.m_failed = true;
+        member.m_error = e.what();
+    } catch (...) {
+        member.m_failed = true;
+        member.m_error = "unknown exception";
+    }
+    timer.stop();
+    member.m_wall_time = timer.GetTimeSeconds();
+}
+
+int ChVehicleFleet::Run(double end_time, double step) {
+    int num_members = (int)m_members.size();
+    int num_threads = std::max(1, std::min(m_num_threads, num_members));
+
+    ChTimer<double> timer;
+    timer.reset();
+    timer.start();
+
+    // Each worker repeatedly claims the next member not yet started
+    std::atomic<int> next(0);
+    auto worker = [&](int thread) {
+        for (int i = next++; i < num_members; i = next++)
+            RunMember(*m_members[i], thread, end_time, step);
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < num_threads; t++)
+        threads.emplace_back(worker, t);
+    worker(0);
+    for (auto& t : threads)
+        t.join();
+
+    timer.stop();
+    m_wall_time = timer.GetTimeSeconds();
+
+    return (int)std::count_if(m_members.begin(), m_members.end(),
+                              [](const std::shared_ptr<ChFleetMember>& m) { return !m->Failed(); });
+}
+
+void ChVehicleFleet::WriteReport(std::ostream& os) const {
+    std::ios::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+
+    double total_time = 0;
+    os << "member  thread   steps   sim time [s]  wall time [s]     RTF" << std::endl;
+    for (size_t i = 0; i < m_members.size(); i++) {
+        const auto& m = m_members[i];
+        double sim_time = m->GetChTime();
+        os << std::setw(6) << i << std::setw(8) << m->GetThread() << std::setw(8) << m->GetNumSteps();
+        os << std::fixed << std::setprecision(3) << std::setw(15) << sim_time << std::setw(15) << m->GetWallTime();
+        os << std::setw(8) << (sim_time > 0 ? m->GetWallTime() / sim_time : 0.0);
+        if (m->Failed())
+            os << "  FAILED: " << m->GetErrorMessage();
+        os << std::endl;
+        total_time += m->GetWallTime();
+    }
+    os << "fleet wall time [s]: " << m_wall_time << "   sum of member wall times [s]: " << total_time;
+    os << "   speedup: " << (m_wall_time > 0 ? total_time / m_wall_time : 0.0) << std::endl;
+
+    os.flags(flags);
+    os.precision(precision);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
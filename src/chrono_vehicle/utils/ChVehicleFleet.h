@@ -0,0 +1,144 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batch runner for many independent vehicle simulations (e.g. the variants of
+// a Monte Carlo maneuver study), advanced concurrently on a pool of threads.
+//
+// Each fleet member owns its own Chrono system, vehicle, terrain, and driver.
+// A member is advanced by a single thread at a time, so members only need to
+// avoid sharing mutable data (systems, terrains, functions) with each other.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_FLEET_H
+#define CH_VEHICLE_FLEET_H
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/ChDriver.h"
+#include "chrono_vehicle/ChTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_utils
+/// @{
+
+/// Base class for a member of a vehicle fleet: one independent simulation.
+/// Derived classes implement a simulation step (synchronize and advance all components).
+class CH_VEHICLE_API ChFleetMember {
+  public:
+    ChFleetMember();
+    virtual ~ChFleetMember() {}
+
+    /// Return the current simulation time of this member.
+    virtual double GetChTime() const = 0;
+
+    /// Synchronize and advance all components of this member by one step.
+    virtual void ExecuteStep(double step) = 0;
+
+    /// Return true if this member should not be advanced further (e.g. the maneuver was
+    /// completed or failed). The default implementation always returns false.
+    virtual bool IsDone() const { return false; }
+
+    /// Return the number of steps executed in the last run.
+    int GetNumSteps() const { return m_num_steps; }
+
+    /// Return the wall clock time (in seconds) spent executing steps in the last run.
+    double GetWallTime() const { return m_wall_time; }
+
+    /// Return the index of the worker thread that ran this member in the last run.
+    int GetThread() const { return m_thread; }
+
+    /// Return true if the last run of this member was interrupted by an exception.
+    bool Failed() const { return m_failed; }
+
+    /// Return the message of the exception that interrupted the last run (if any).
+    const std::string& GetErrorMessage() const { return m_error; }
+
+  private:
+    int m_num_steps;
+    double m_wall_time;
+    int m_thread;
+    bool m_failed;
+    std::string m_error;
+
+    friend class ChVehicleFleet;
+};
+
+/// Fleet member consisting of a wheeled vehicle, a terrain, and a driver.
+/// The vehicle, terrain, and driver must not be shared with other members.
+class CH_VEHICLE_API ChWheeledFleetMember : public ChFleetMember {
+  public:
+    ChWheeledFleetMember(std::shared_ptr<ChWheeledVehicle> vehicle,
+                         std::shared_ptr<ChTerrain> terrain,
+                         std::shared_ptr<ChDriver> driver);
+
+    virtual double GetChTime() const override { return m_vehicle->GetChTime(); }
+    virtual void ExecuteStep(double step) override;
+
+    std::shared_ptr<ChWheeledVehicle> GetVehicle() const { return m_vehicle; }
+    std::shared_ptr<ChTerrain> GetTerrain() const { return m_terrain; }
+    std::shared_ptr<ChDriver> GetDriver() const { return m_driver; }
+
+  protected:
+    std::shared_ptr<ChWheeledVehicle> m_vehicle;
+    std::shared_ptr<ChTerrain> m_terrain;
+    std::shared_ptr<ChDriver> m_driver;
+};
+
+/// Batch runner for a fleet of independent vehicle simulations.
+/// Members are distributed dynamically over a pool of worker threads: each worker runs one
+/// member to the end time, then picks the next member not yet started. An exception thrown by
+/// a member stops that member only; it is reported through ChFleetMember::Failed().
+class CH_VEHICLE_API ChVehicleFleet {
+  public:
+    ChVehicleFleet();
+
+    /// Add a member to the fleet.
+    void AddMember(std::shared_ptr<ChFleetMember> member) { m_members.push_back(member); }
+
+    /// Return the fleet members.
+    const std::vector<std::shared_ptr<ChFleetMember>>& GetMembers() const { return m_members; }
+
+    /// Set the number of worker threads (default: number of hardware threads).
+    void SetNumThreads(int num_threads) { m_num_threads = num_threads; }
+
+    /// Advance all members with the given step size until they reach the specified end time
+    /// (or report IsDone). Returns the number of members that completed without errors.
+    int Run(double end_time, double step);
+
+    /// Return the wall clock time (in seconds) of the last run.
+    double GetWallTime() const { return m_wall_time; }
+
+    /// Write a per-member timing report to the given stream.
+    void WriteReport(std::ostream& os) const;
+
+  private:
+    void RunMember(ChFleetMember& member, int thread, double end_time, double step);
+
+    std::vector<std::shared_ptr<ChFleetMember>> m_members;
+    int m_num_threads;
+    double m_wall_time;
+};
+
+/// @} vehicle_utils
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -26,6 +26,7 @@
 #include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/ChWorldFrame.h"
 #include "chrono_vehicle/wheeled_vehicle/ChTire.h"
+#include "chrono_vehicle/utils/ChVehicleDataCache.h"
 
 #include "chrono_thirdparty/filesystem/path.h"
 
@@ -64,6 +65,20 @@ double ChTire::ReportMass() const {
     return GetMass();
 }
 
+// -----------------------------------------------------------------------------
+// Local terrain snapshot for tire-terrain collision detection
+// -----------------------------------------------------------------------------
+void ChTire::EnableTerrainSnapshot(double resolution, double size) {
+    m_snapshot = std::unique_ptr<ChTerrainSnapshot>(new ChTerrainSnapshot(resolution, size));
+}
+
+const ChTerrain& ChTire::GetCollisionTerrain(const ChTerrain& terrain, const ChVector<>& center) {
+    if (!m_snapshot)
+        return terrain;
+    m_snapshot->Update(terrain, center);
+    return *m_snapshot;
+}
+
 // -----------------------------------------------------------------------------
 // Calculate kinematics quantities (slip angle, longitudinal slip, camber angle,
 // and toe-in angle) using the given state of the associated wheel.
@@ -113,8 +128,8 @@ std::shared_ptr<ChTriangleMeshShape> ChTire::AddVisualizationMesh(const std::str
     ChQuaternion<> rot = left ? Q_from_AngZ(0) : Q_from_AngZ(CH_C_PI);
     m_vis_mesh_file = left ? mesh_file_left : mesh_file_right;
 
-    auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
-    trimesh->LoadWavefrontMesh(vehicle::GetDataFile(m_vis_mesh_file), false, false);
+    auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>(
+        *LoadMeshWavefront(vehicle::GetDataFile(m_vis_mesh_file)));  // copy of a possibly shared mesh
     trimesh->Transform(ChVector<>(0, GetOffset(), 0), ChMatrix33<>(rot));
 
     auto trimesh_shape = chrono_types::make_shared<ChTriangleMeshShape>();
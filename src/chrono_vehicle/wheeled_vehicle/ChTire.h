@@ -30,6 +30,7 @@
 #include "chrono_vehicle/ChApiVehicle.h"
 #include "chrono_vehicle/ChPart.h"
 #include "chrono_vehicle/ChTerrain.h"
+#include "chrono_vehicle/ChTerrainSnapshot.h"
 #include "chrono_vehicle/wheeled_vehicle/ChWheel.h"
 
 namespace chrono {
@@ -62,6 +63,18 @@ class CH_VEHICLE_API ChTire : public ChPart {
     /// Default: SINGLE_POINT
     void SetCollisionType(CollisionType collision_type) { m_collision_type = collision_type; }
 
+    /// Perform tire-terrain collision detection on a local heightfield snapshot of the terrain, refreshed
+    /// incrementally as the wheel moves, instead of querying the terrain directly (default: disabled).
+    /// This reduces the cost of collision methods with many height queries (e.g. ENVELOPE) on expensive terrains
+    /// (e.g. RigidTerrain mesh patches or CRGTerrain), at the cost of a bilinear approximation of the terrain
+    /// surface. The snapshot must only be used with terrains whose height does not change in time.
+    void EnableTerrainSnapshot(double resolution,  ///< grid spacing
+                               double size         ///< side length of the grid (at least the tire diameter)
+    );
+
+    /// Revert to direct terrain queries for tire-terrain collision detection.
+    void DisableTerrainSnapshot() { m_snapshot.reset(); }
+
     /// Get the tire radius.
     virtual double GetRadius() const = 0;
 
@@ -218,6 +231,10 @@ class CH_VEHICLE_API ChTire : public ChPart {
         double& depth                        ///< [out] penetration depth (positive if contact occurred)
     );
 
+    /// Return the terrain to be used for tire-terrain collision detection: the local terrain snapshot, centered
+    /// at the given location, if enabled and the given terrain otherwise.
+    const ChTerrain& GetCollisionTerrain(const ChTerrain& terrain, const ChVector<>& center);
+
     /// Utility function to construct a loopkup table for penetration depth as function of intersection area,
     /// for a given tire radius.  The return map can be used in DiscTerrainCollisionEnvelope.
     static void ConstructAreaDepthTable(double disc_radius, ChFunction_Recorder& areaDep);
@@ -229,6 +246,8 @@ class CH_VEHICLE_API ChTire : public ChPart {
     std::string m_vis_mesh_file;  ///< name of OBJ file for visualization of this tire (may be empty)
 
   private:
+    std::unique_ptr<ChTerrainSnapshot> m_snapshot;  ///< local terrain snapshot for collision detection (if enabled)
+
     double m_slip_angle;
     double m_longitudinal_slip;
     double m_camber_angle;
@@ -29,6 +29,7 @@
 #include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/wheeled_vehicle/ChWheel.h"
 #include "chrono_vehicle/wheeled_vehicle/ChTire.h"
+#include "chrono_vehicle/utils/ChVehicleDataCache.h"
 
 #include "chrono_thirdparty/filesystem/path.h"
 
@@ -88,8 +89,8 @@ void ChWheel::AddVisualizationAssets(VisualizationType vis) {
 
     if (vis == VisualizationType::MESH && !m_vis_mesh_file.empty()) {
         ChQuaternion<> rot = (m_side == VehicleSide::LEFT) ? Q_from_AngZ(0) : Q_from_AngZ(CH_C_PI);
-        auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
-        trimesh->LoadWavefrontMesh(vehicle::GetDataFile(m_vis_mesh_file), false, false);
+        auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>(
+            *LoadMeshWavefront(vehicle::GetDataFile(m_vis_mesh_file)));  // copy of a possibly shared mesh
         trimesh->Transform(ChVector<>(0, m_offset, 0), ChMatrix33<>(rot));
         m_trimesh_shape = chrono_types::make_shared<ChTriangleMeshShape>();
         m_trimesh_shape->Pos = ChVector<>(0, m_offset, 0);
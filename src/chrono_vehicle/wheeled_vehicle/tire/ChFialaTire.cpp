@@ -39,7 +39,14 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 ChFialaTire::ChFialaTire(const std::string& name)
-    : ChTire(name), m_dynamic_mode(false), m_mu(0.8), m_mu_0(0.8), m_time_trans(0.2), m_c_slip(0), m_c_alpha(0) {
+    : ChTire(name),
+      m_dynamic_mode(false),
+      m_mu(0.8),
+      m_mu_0(0.8),
+      m_time_trans(0.2),
+      m_c_slip(0),
+      m_c_alpha(0),
+      m_bank(nullptr) {
     m_tireforce.force = ChVector<>(0, 0, 0);
     m_tireforce.point = ChVector<>(0, 0, 0);
     m_tireforce.moment = ChVector<>(0, 0, 0);
@@ -112,19 +119,24 @@ void ChFialaTire::Synchronize(double time,
     ChVector<> disc_normal = A.Get_A_Yaxis();
 
     double dum_cam = 0;
+
+    // Terrain used for collision detection (local heightfield snapshot, if enabled)
+    const ChTerrain& collision_terrain = GetCollisionTerrain(terrain, wheel_state.pos);
+
     // Assuming the tire is a disc, check contact with terrain
     switch (m_collision_type) {
         case ChTire::CollisionType::SINGLE_POINT:
-            m_data.in_contact = DiscTerrainCollision(terrain, wheel_state.pos, disc_normal, m_unloaded_radius,
+            m_data.in_contact = DiscTerrainCollision(collision_terrain, wheel_state.pos, disc_normal, m_unloaded_radius,
                                                      m_data.frame, m_data.depth);
             break;
         case ChTire::CollisionType::FOUR_POINTS:
-            m_data.in_contact = DiscTerrainCollision4pt(terrain, wheel_state.pos, disc_normal, m_unloaded_radius,
-                                                        m_width, m_data.frame, m_data.depth, dum_cam);
+            m_data.in_contact =
+                DiscTerrainCollision4pt(collision_terrain, wheel_state.pos, disc_normal, m_unloaded_radius, m_width,
+                                        m_data.frame, m_data.depth, dum_cam);
             break;
         case ChTire::CollisionType::ENVELOPE:
-            m_data.in_contact = DiscTerrainCollisionEnvelope(terrain, wheel_state.pos, disc_normal, m_unloaded_radius,
-                                                             m_areaDep, m_data.frame, m_data.depth);
+            m_data.in_contact = DiscTerrainCollisionEnvelope(collision_terrain, wheel_state.pos, disc_normal,
+                                                             m_unloaded_radius, m_areaDep, m_data.frame, m_data.depth);
             break;
     }
 
@@ -168,6 +180,10 @@ void ChFialaTire::Synchronize(double time,
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 void ChFialaTire::Advance(double step) {
+    // Forces of tires in a bank are evaluated by ChFialaTireBank::Advance.
+    if (m_bank)
+        return;
+
     // Set tire forces to zero.
     m_tireforce.point = m_wheel->GetPos();
     m_tireforce.force = ChVector<>(0, 0, 0);
@@ -187,20 +203,6 @@ void ChFialaTire::Advance(double step) {
     //  m_states.alpha_l = 0;
     //}
 
-    const double vnum = 0.01;
-
-    // smoothing interval for My
-    const double vx_min = 0.125;
-    const double vx_max = 0.5;
-
-    // limits for time lags
-    const double tau_min = 1.0e-4;
-    const double tau_max = 0.25;
-
-    // lag times for relaxation
-    double tau_k;
-    double tau_a;
-
     if (m_states.abs_vx != 0) {
         m_states.kappa = -m_states.vsx / m_states.abs_vx;
         m_states.alpha = std::atan2(m_states.vsy, m_states.abs_vx);
@@ -208,25 +210,41 @@ void ChFialaTire::Advance(double step) {
         m_states.kappa = 0;
         m_states.alpha = 0;
     }
-    // Relaxation time varies with rotational tire speed. Stand still or very low speed generates
-    // unrealistic lags and causes bad  oscillations. Tau == 0 is not allowed in later calculations
-    tau_k = ChClamp(m_relax_length_x / (m_states.abs_vt + vnum), tau_min, tau_max);
-    tau_a = ChClamp(m_relax_length_y / (m_states.abs_vt + vnum), tau_min, tau_max);
 
     // Now calculate the new force and moment values.
     // Normal force and moment have already been accounted for in Synchronize().
     // See reference for more detail on the calculations
     double Fx = 0;
     double Fy = 0;
-    double My = 0;
     double Mz = 0;
 
     FialaPatchForces(Fx, Fy, Mz, m_states.kappa, m_states.alpha, m_data.normal_force);
 
+    UpdateTireForce(step, Fx, Fy, Mz);
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+void ChFialaTire::UpdateTireForce(double step, double Fx, double Fy, double Mz) {
+    const double vnum = 0.01;
+
+    // smoothing interval for My
+    const double vx_min = 0.125;
+    const double vx_max = 0.5;
+
+    // limits for time lags
+    const double tau_min = 1.0e-4;
+    const double tau_max = 0.25;
+
+    // Relaxation time varies with rotational tire speed. Stand still or very low speed generates
+    // unrealistic lags and causes bad  oscillations. Tau == 0 is not allowed in later calculations
+    double tau_k = ChClamp(m_relax_length_x / (m_states.abs_vt + vnum), tau_min, tau_max);
+    double tau_a = ChClamp(m_relax_length_y / (m_states.abs_vt + vnum), tau_min, tau_max);
+
     // Smoothing factor dependend on m_state.abs_vx, allows soft switching of My
     double myStartUp = ChSineStep(m_states.abs_vx, vx_min, 0.0, vx_max, 1.0);
     // Rolling Resistance
-    My = -myStartUp * m_rolling_resistance * m_data.normal_force * ChSignum(m_states.omega);
+    double My = -myStartUp * m_rolling_resistance * m_data.normal_force * ChSignum(m_states.omega);
 
     if (m_dynamic_mode && (m_relax_length_x > 0.0) && (m_relax_length_y > 0.0)) {
         // Integration of the ODEs
@@ -31,6 +31,8 @@
 namespace chrono {
 namespace vehicle {
 
+class ChFialaTireBank;
+
 /// @addtogroup vehicle_wheeled_tire
 /// @{
 
@@ -164,6 +166,15 @@ class CH_VEHICLE_API ChFialaTire : public ChTire {
 
     std::shared_ptr<ChCylinderShape> m_cyl_shape;  ///< visualization cylinder asset
     std::shared_ptr<ChTexture> m_texture;          ///< visualization texture asset
+
+  private:
+    /// Complete the tire force from the steady-state patch forces (relaxation, rolling resistance,
+    /// start transient, transformation to the wheel center).
+    void UpdateTireForce(double step, double Fx, double Fy, double Mz);
+
+    ChFialaTireBank* m_bank;  ///< bank evaluating the forces of this tire (if any)
+
+    friend class ChFialaTireBank;
 };
 
 /// @} vehicle_wheeled_tire
@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batched force evaluation for a set of Fiala tires.
+//
+// The patch force kernel is the branch-free equivalent of
+// ChFialaTire::FialaPatchForces. The slip angle only enters through its
+// tangent, so the kernel uses tan(alpha) = vsy / |vx| directly and compares
+// it against the tangent of the critical slip angle; this leaves only a
+// square root in the loop body.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "chrono_vehicle/wheeled_vehicle/tire/ChFialaTireBank.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChFialaTireBank::~ChFialaTireBank() {
+    Clear();
+}
+
+void ChFialaTireBank::AddTire(std::shared_ptr<ChFialaTire> tire) {
+    assert(!tire->m_bank);
+    tire->m_bank = this;
+    m_tires.push_back(tire);
+}
+
+void ChFialaTireBank::Clear() {
+    for (auto& tire : m_tires)
+        tire->m_bank = nullptr;
+    m_tires.clear();
+}
+
+void ChFialaTireBank::Resize(size_t n) {
+    m_abs_vx.resize(n);
+    m_vsx.resize(n);
+    m_vsy.resize(n);
+    m_fz.resize(n);
+    m_mu_scale.resize(n);
+    m_c_slip.resize(n);
+    m_c_alpha.resize(n);
+    m_u_min.resize(n);
+    m_u_max.resize(n);
+    m_width.resize(n);
+    m_kappa.resize(n);
+    m_fx.resize(n);
+    m_fy.resize(n);
+    m_mz.resize(n);
+}
+
+void ChFialaTireBank::Advance(double step) {
+    size_t n = m_tires.size();
+    Resize(n);
+
+    // Gather tire states and parameters
+    for (size_t i = 0; i < n; i++) {
+        const ChFialaTire& tire = *m_tires[i];
+        m_abs_vx[i] = tire.m_states.abs_vx;
+        m_vsx[i] = tire.m_states.vsx;
+        m_vsy[i] = tire.m_states.vsy;
+        m_fz[i] = tire.m_data.normal_force;
+        m_mu_scale[i] = tire.m_mu / tire.m_mu_0;
+        m_c_slip[i] = tire.m_c_slip;
+        m_c_alpha[i] = tire.m_c_alpha;
+        m_u_min[i] = tire.m_u_min;
+        m_u_max[i] = tire.m_u_max;
+        m_width[i] = tire.m_width;
+    }
+
+    // Steady-state patch forces for all tires.
+    // Tires not in contact are evaluated too (their results are discarded).
+    const double* abs_vx = m_abs_vx.data();
+    const double* vsx = m_vsx.data();
+    const double* vsy = m_vsy.data();
+    const double* fz = m_fz.data();
+    const double* mu_scale = m_mu_scale.data();
+    const double* c_slip = m_c_slip.data();
+    const double* c_alpha = m_c_alpha.data();
+    const double* u_min = m_u_min.data();
+    const double* u_max = m_u_max.data();
+    const double* width = m_width.data();
+    double* kappa = m_kappa.data();
+    double* fx = m_fx.data();
+    double* fy = m_fy.data();
+    double* mz = m_mz.data();
+
+    for (size_t i = 0; i < n; i++) {
+        bool moving = abs_vx[i] != 0;
+        double k = moving ? -vsx[i] / abs_vx[i] : 0.0;
+        double tan_a = moving ? vsy[i] / abs_vx[i] : 0.0;
+        double abs_k = std::abs(k);
+        double abs_tan_a = std::abs(tan_a);
+        double sign_k = (k > 0) - (k < 0);
+        double sign_a = (tan_a > 0) - (tan_a < 0);
+
+        double SsA = std::min(1.0, std::sqrt(k * k + tan_a * tan_a));
+        double U = u_max[i] - (u_max[i] - u_min[i]) * SsA;
+        double S_critical = std::abs(U * fz[i] / (2 * c_slip[i]));
+        double tan_critical = 3 * U * fz[i] / c_alpha[i];
+
+        // modify U due to local friction
+        double Ufz = U * mu_scale[i] * fz[i];
+
+        // Longitudinal force
+        double fx_lin = c_slip[i] * k;
+        double fx_sat = sign_k * (Ufz - std::abs(Ufz * Ufz / (4 * k * c_slip[i])));
+        fx[i] = (abs_k < S_critical) ? fx_lin : fx_sat;
+
+        // Lateral force and aligning moment
+        bool adhesion = abs_tan_a <= tan_critical;
+        double H = 1.0 - c_alpha[i] * abs_tan_a / (3.0 * Ufz);
+        double H3 = H * H * H;
+        fy[i] = adhesion ? -Ufz * (1.0 - H3) * sign_a : -Ufz * sign_a;
+        mz[i] = adhesion ? Ufz * width[i] * (1.0 - H) * H3 * sign_a : 0.0;
+
+        kappa[i] = k;
+    }
+
+    // Scatter: complete the tire forces
+    for (size_t i = 0; i < n; i++) {
+        ChFialaTire& tire = *m_tires[i];
+
+        tire.m_tireforce.point = tire.m_wheel->GetPos();
+        tire.m_tireforce.force = ChVector<>(0, 0, 0);
+        tire.m_tireforce.moment = ChVector<>(0, 0, 0);
+
+        if (!tire.m_data.in_contact)
+            continue;
+
+        tire.m_states.kappa = kappa[i];
+        tire.m_states.alpha = (abs_vx[i] != 0) ? std::atan2(vsy[i], abs_vx[i]) : 0.0;
+        tire.UpdateTireForce(step, fx[i], fy[i], mz[i]);
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batched force evaluation for a set of Fiala tires, possibly belonging to
+// different vehicles.
+//
+// =============================================================================
+
+#ifndef CH_FIALA_TIRE_BANK_H
+#define CH_FIALA_TIRE_BANK_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChFialaTire.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled_tire
+/// @{
+
+/// Batched force evaluation for a set of Fiala tires.
+/// Tires added to a bank are still synchronized by their vehicles (terrain contact and slip
+/// velocities), but their forces are no longer computed by ChFialaTire::Advance. Instead, a call to
+/// ChFialaTireBank::Advance gathers the states of all tires in the bank into contiguous arrays,
+/// evaluates the Fiala model for all of them in branch-free loops (which the compiler can vectorize
+/// across tires), and scatters the resulting forces back to the tires.
+///
+/// With several vehicles, the bank must be advanced after all vehicles were synchronized and before
+/// any of them is synchronized again, for example:
+/// <pre>
+///   for (auto& v : vehicles) v->Synchronize(time, inputs, terrain);
+///   bank.Advance(step);
+///   for (auto& v : vehicles) v->Advance(step);
+/// </pre>
+class CH_VEHICLE_API ChFialaTireBank {
+  public:
+    ChFialaTireBank() {}
+    ~ChFialaTireBank();
+
+    /// Add a tire to this bank. A tire can belong to at most one bank.
+    void AddTire(std::shared_ptr<ChFialaTire> tire);
+
+    /// Remove all tires from this bank (their forces are again computed by ChFialaTire::Advance).
+    void Clear();
+
+    /// Return the number of tires in this bank.
+    size_t GetNumTires() const { return m_tires.size(); }
+
+    /// Evaluate the forces of all tires in the bank, for a tire step of the given length.
+    void Advance(double step);
+
+  private:
+    void Resize(size_t n);
+
+    std::vector<std::shared_ptr<ChFialaTire>> m_tires;
+
+    // Inputs (gathered from the tires)
+    std::vector<double> m_abs_vx;
+    std::vector<double> m_vsx;
+    std::vector<double> m_vsy;
+    std::vector<double> m_fz;
+    std::vector<double> m_mu_scale;
+    std::vector<double> m_c_slip;
+    std::vector<double> m_c_alpha;
+    std::vector<double> m_u_min;
+    std::vector<double> m_u_max;
+    std::vector<double> m_width;
+
+    // Outputs
+    std::vector<double> m_kappa;
+    std::vector<double> m_fx;
+    std::vector<double> m_fy;
+    std::vector<double> m_mz;
+};
+
+/// @} vehicle_wheeled_tire
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -121,13 +121,16 @@ void ChLugreTire::Synchronize(double time,
     // forces, and cache data that only depends on wheel state.
     double depth;
 
+    // Terrain used for collision detection (local heightfield snapshot, if enabled)
+    const ChTerrain& collision_terrain = GetCollisionTerrain(terrain, wheel_state.pos);
+
     for (int id = 0; id < GetNumDiscs(); id++) {
         // Calculate center of disk (expressed in global frame)
         ChVector<> disc_center = wheel_state.pos + disc_locs[id] * disc_normal;
 
         // Check contact with terrain and calculate contact points.
-        m_data[id].in_contact =
-            DiscTerrainCollision(terrain, disc_center, disc_normal, disc_radius, m_data[id].frame, depth);
+        m_data[id].in_contact = DiscTerrainCollision(collision_terrain, disc_center, disc_normal, disc_radius,
+                                                     m_data[id].frame, depth);
         if (!m_data[id].in_contact)
             continue;
 
@@ -316,19 +316,22 @@ void ChPac02Tire::Synchronize(double time, const ChTerrain& terrain) {
 
     double dum_cam;
 
+    // Terrain used for collision detection (local heightfield snapshot, if enabled)
+    const ChTerrain& collision_terrain = GetCollisionTerrain(terrain, wheel_state.pos);
+
     // Assuming the tire is a disc, check contact with terrain
     switch (m_collision_type) {
         case ChTire::CollisionType::SINGLE_POINT:
-            m_data.in_contact =
-                DiscTerrainCollision(terrain, wheel_state.pos, disc_normal, m_PacCoeff.R0, m_data.frame, m_data.depth);
+            m_data.in_contact = DiscTerrainCollision(collision_terrain, wheel_state.pos, disc_normal, m_PacCoeff.R0,
+                                                     m_data.frame, m_data.depth);
             break;
         case ChTire::CollisionType::FOUR_POINTS:
-            m_data.in_contact = DiscTerrainCollision4pt(terrain, wheel_state.pos, disc_normal, m_PacCoeff.R0,
+            m_data.in_contact = DiscTerrainCollision4pt(collision_terrain, wheel_state.pos, disc_normal, m_PacCoeff.R0,
                                                         m_PacCoeff.width, m_data.frame, m_data.depth, dum_cam);
             break;
         case ChTire::CollisionType::ENVELOPE:
-            m_data.in_contact = DiscTerrainCollisionEnvelope(terrain, wheel_state.pos, disc_normal, m_PacCoeff.R0,
-                                                             m_areaDep, m_data.frame, m_data.depth);
+            m_data.in_contact = DiscTerrainCollisionEnvelope(collision_terrain, wheel_state.pos, disc_normal,
+                                                             m_PacCoeff.R0, m_areaDep, m_data.frame, m_data.depth);
             break;
     }
     if (m_data.in_contact) {
@@ -30,6 +30,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <map>
+#include <mutex>
+#include <random>
 
 #include "chrono/core/ChGlobal.h"
 
@@ -41,7 +44,18 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 ChPac89Tire::ChPac89Tire(const std::string& name)
-    : ChTire(name), m_kappa(0), m_alpha(0), m_gamma(0), m_gamma_limit(3), m_mu(0), m_mu0(0.8) {
+    : ChTire(name),
+      m_kappa(0),
+      m_alpha(0),
+      m_gamma(0),
+      m_gamma_limit(3),
+      m_mu(0),
+      m_mu0(0.8),
+      m_tabulate(false),
+      m_tab_max_load(0),
+      m_tab_num_slip(0),
+      m_tab_num_camber(0),
+      m_tab_num_load(0) {
     m_tireforce.force = ChVector<>(0, 0, 0);
     m_tireforce.point = ChVector<>(0, 0, 0);
     m_tireforce.moment = ChVector<>(0, 0, 0);
@@ -62,6 +76,9 @@ void ChPac89Tire::Initialize(std::shared_ptr<ChWheel> wheel) {
     m_states.cp_long_slip = 0;
     m_states.cp_side_slip = 0;
     m_states.R_eff = m_unloaded_radius;
+
+    if (m_tabulate)
+        BuildTables();
 }
 
 // -----------------------------------------------------------------------------
@@ -114,19 +131,23 @@ void ChPac89Tire::Synchronize(double time,
 
     double dum_cam;
 
+    // Terrain used for collision detection (local heightfield snapshot, if enabled)
+    const ChTerrain& collision_terrain = GetCollisionTerrain(terrain, wheel_state.pos);
+
     // Assuming the tire is a disc, check contact with terrain
     switch (m_collision_type) {
         case ChTire::CollisionType::SINGLE_POINT:
-            m_data.in_contact = DiscTerrainCollision(terrain, wheel_state.pos, disc_normal, m_unloaded_radius,
+            m_data.in_contact = DiscTerrainCollision(collision_terrain, wheel_state.pos, disc_normal, m_unloaded_radius,
                                                      m_data.frame, m_data.depth);
             break;
         case ChTire::CollisionType::FOUR_POINTS:
-            m_data.in_contact = DiscTerrainCollision4pt(terrain, wheel_state.pos, disc_normal, m_unloaded_radius,
-                                                        m_width, m_data.frame, m_data.depth, dum_cam);
+            m_data.in_contact =
+                DiscTerrainCollision4pt(collision_terrain, wheel_state.pos, disc_normal, m_unloaded_radius, m_width,
+                                        m_data.frame, m_data.depth, dum_cam);
             break;
         case ChTire::CollisionType::ENVELOPE:
-            m_data.in_contact = DiscTerrainCollisionEnvelope(terrain, wheel_state.pos, disc_normal, m_unloaded_radius,
-                                                             m_areaDep, m_data.frame, m_data.depth);
+            m_data.in_contact = DiscTerrainCollisionEnvelope(collision_terrain, wheel_state.pos, disc_normal,
+                                                             m_unloaded_radius, m_areaDep, m_data.frame, m_data.depth);
             break;
     }
     if (m_data.in_contact) {
@@ -217,56 +238,31 @@ void ChPac89Tire::Advance(double step) {
     // Clamp |gamma| to specified value: Limit due to tire testing, avoids erratic extrapolation.
     double gamma = ChClamp(m_gamma, -m_gamma_limit, m_gamma_limit);
 
-    // Longitudinal Force
-    {
-        double C = m_PacCoeff.B0;
-        double D = (m_PacCoeff.B1 * std::pow(Fz, 2) + m_PacCoeff.B2 * Fz);
-        double BCD = (m_PacCoeff.B3 * std::pow(Fz, 2) + m_PacCoeff.B4 * Fz) * std::exp(-m_PacCoeff.B5 * Fz);
-        double B = BCD / (C * D);
-        double Sh = m_PacCoeff.B9 * Fz + m_PacCoeff.B10;
-        double Sv = 0.0;
-        double X1 = (m_kappa + Sh);
-        double E = (m_PacCoeff.B6 * std::pow(Fz, 2) + m_PacCoeff.B7 * Fz + m_PacCoeff.B8);
-
-        Fx = mu_scale * (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
+    // Pure-slip Magic Formula terms, from the precomputed tables if available
+    double Fx0, Fy0, Mz0;
+    if (m_tables && InTables(gamma, Fz)) {
+        Fx0 = InterpFx(m_kappa, Fz);
+        InterpFyMz(m_alpha, gamma, Fz, Fy0, Mz0);
+    } else {
+        Fx0 = CalcFx(m_kappa, Fz);
+        Fy0 = CalcFy(m_alpha, gamma, Fz);
+        Mz0 = CalcMz(m_alpha, gamma, Fz);
     }
 
+    // Longitudinal Force
+    Fx = mu_scale * Fx0;
+
     // Lateral Force
     {
-        double C = m_PacCoeff.A0;
-        double D = (m_PacCoeff.A1 * std::pow(Fz, 2) + m_PacCoeff.A2 * Fz);
-        double BCD =
-            m_PacCoeff.A3 * std::sin(std::atan(Fz / m_PacCoeff.A4) * 2.0) * (1.0 - m_PacCoeff.A5 * std::abs(gamma));
-        double B = BCD / (C * D);
-        double Sh = m_PacCoeff.A9 * Fz + m_PacCoeff.A10 + m_PacCoeff.A8 * gamma;
         double Sv = m_PacCoeff.A11 * Fz * gamma + m_PacCoeff.A12 * Fz + m_PacCoeff.A13;
-        double X1 = m_alpha + Sh;
-        double E = m_PacCoeff.A6 * Fz + m_PacCoeff.A7;
-
-        // Ensure that X1 stays within +/-90 deg minus a little bit
-        ChClampValue(X1, -89.5, 89.5);
-
-        Fy = mu_scale * (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
+        Fy = mu_scale * Fy0 + Sv;
     }
 
     // Self-Aligning Torque
     {
-        double C = m_PacCoeff.C0;
-        double D = (m_PacCoeff.C1 * std::pow(Fz, 2) + m_PacCoeff.C2 * Fz);
-        double BCD = (m_PacCoeff.C3 * std::pow(Fz, 2) + m_PacCoeff.C4 * Fz) * (1 - m_PacCoeff.C6 * std::abs(gamma)) *
-                     std::exp(-m_PacCoeff.C5 * Fz);
-        double B = BCD / (C * D);
-        double Sh = m_PacCoeff.C11 * gamma + m_PacCoeff.C12 * Fz + m_PacCoeff.C13;
         double Sv =
             (m_PacCoeff.C14 * std::pow(Fz, 2) + m_PacCoeff.C15 * Fz) * gamma + m_PacCoeff.C16 * Fz + m_PacCoeff.C17;
-        double X1 = m_alpha + Sh;
-        double E = (m_PacCoeff.C7 * std::pow(Fz, 2) + m_PacCoeff.C8 * Fz + m_PacCoeff.C9) *
-                   (1.0 - m_PacCoeff.C10 * std::abs(gamma));
-
-        // Ensure that X1 stays within +/-90 deg minus a little bit
-        ChClampValue(X1, -89.5, 89.5);
-
-        Mz = mu_scale * (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
+        Mz = mu_scale * Mz0 + Sv;
     }
 
     // Overturning Moment
@@ -316,5 +312,237 @@ void ChPac89Tire::Advance(double step) {
         Vcross((m_data.frame.pos + m_data.depth * m_data.frame.rot.GetZaxis()) - m_tireforce.point, m_tireforce.force);
 }
 
+// -----------------------------------------------------------------------------
+// Pure-slip Magic Formula terms (without friction scaling and vertical shifts).
+// Fz in kN, kappa in percent, alpha and gamma in degrees.
+// -----------------------------------------------------------------------------
+double ChPac89Tire::CalcFx(double kappa, double Fz) const {
+    double C = m_PacCoeff.B0;
+    double D = (m_PacCoeff.B1 * std::pow(Fz, 2) + m_PacCoeff.B2 * Fz);
+    double BCD = (m_PacCoeff.B3 * std::pow(Fz, 2) + m_PacCoeff.B4 * Fz) * std::exp(-m_PacCoeff.B5 * Fz);
+    double B = BCD / (C * D);
+    double Sh = m_PacCoeff.B9 * Fz + m_PacCoeff.B10;
+    double X1 = (kappa + Sh);
+    double E = (m_PacCoeff.B6 * std::pow(Fz, 2) + m_PacCoeff.B7 * Fz + m_PacCoeff.B8);
+
+    return D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))));
+}
+
+double ChPac89Tire::CalcFy(double alpha, double gamma, double Fz) const {
+    double C = m_PacCoeff.A0;
+    double D = (m_PacCoeff.A1 * std::pow(Fz, 2) + m_PacCoeff.A2 * Fz);
+    double BCD =
+        m_PacCoeff.A3 * std::sin(std::atan(Fz / m_PacCoeff.A4) * 2.0) * (1.0 - m_PacCoeff.A5 * std::abs(gamma));
+    double B = BCD / (C * D);
+    double Sh = m_PacCoeff.A9 * Fz + m_PacCoeff.A10 + m_PacCoeff.A8 * gamma;
+    double X1 = alpha + Sh;
+    double E = m_PacCoeff.A6 * Fz + m_PacCoeff.A7;
+
+    // Ensure that X1 stays within +/-90 deg minus a little bit
+    ChClampValue(X1, -89.5, 89.5);
+
+    return D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))));
+}
+
+double ChPac89Tire::CalcMz(double alpha, double gamma, double Fz) const {
+    double C = m_PacCoeff.C0;
+    double D = (m_PacCoeff.C1 * std::pow(Fz, 2) + m_PacCoeff.C2 * Fz);
+    double BCD = (m_PacCoeff.C3 * std::pow(Fz, 2) + m_PacCoeff.C4 * Fz) * (1 - m_PacCoeff.C6 * std::abs(gamma)) *
+                 std::exp(-m_PacCoeff.C5 * Fz);
+    double B = BCD / (C * D);
+    double Sh = m_PacCoeff.C11 * gamma + m_PacCoeff.C12 * Fz + m_PacCoeff.C13;
+    double X1 = alpha + Sh;
+    double E = (m_PacCoeff.C7 * std::pow(Fz, 2) + m_PacCoeff.C8 * Fz + m_PacCoeff.C9) *
+               (1.0 - m_PacCoeff.C10 * std::abs(gamma));
+
+    // Ensure that X1 stays within +/-90 deg minus a little bit
+    ChClampValue(X1, -89.5, 89.5);
+
+    return D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))));
+}
+
+// -----------------------------------------------------------------------------
+// Tabulated Magic Formula
+//
+// Slip grids are uniform in u = sign(s) sqrt(|s| / s_max), which places most grid
+// points near zero slip where the formulas vary fastest. Camber and load grids
+// are uniform. Values are interpolated linearly in each grid direction.
+// -----------------------------------------------------------------------------
+
+static const double kappa_max = 100;  // longitudinal slip range (percent)
+static const double alpha_max = 90;   // slip angle range (degrees)
+
+// Coordinate of the given slip value on the clustered slip grid
+static inline double SlipCoordinate(double s, double s_max, int n) {
+    double u = std::sqrt(std::min(std::abs(s) / s_max, 1.0));
+    return 0.5 * (std::copysign(u, s) + 1) * (n - 1);
+}
+
+// Slip value at the given node of the clustered slip grid
+static inline double SlipNode(int i, double s_max, int n) {
+    double u = 2.0 * i / (n - 1) - 1;
+    return s_max * u * std::abs(u);
+}
+
+// Split a grid coordinate in [0, n-1] into a cell index and a local coordinate in [0, 1]
+static inline void GridCell(double x, int n, int& i, double& t) {
+    i = std::min(std::max((int)x, 0), n - 2);
+    t = x - i;
+}
+
+void ChPac89Tire::EnableTabulation(double max_load, int num_slip, int num_camber, int num_load) {
+    m_tabulate = true;
+    m_tab_max_load = max_load;
+    m_tab_num_slip = std::max(num_slip, 3) | 1;  // odd, so that zero slip is a grid node
+    m_tab_num_camber = std::max(num_camber, 2);
+    m_tab_num_load = std::max(num_load, 2);
+
+    // Build the tables now if the tire was already initialized
+    if (m_wheel)
+        BuildTables();
+}
+
+void ChPac89Tire::DisableTabulation() {
+    m_tabulate = false;
+    m_tables = nullptr;
+}
+
+void ChPac89Tire::BuildTables() {
+    int ns = m_tab_num_slip;
+    int nc = m_tab_num_camber;
+    int nl = m_tab_num_load;
+    double gamma_max = m_gamma_limit;
+    double Fz_max = m_tab_max_load / 1000;
+
+    // Tables are shared by tires with identical parameters and resolutions
+    static std::mutex cache_mutex;
+    static std::map<std::vector<double>, std::weak_ptr<const Tables>> cache;
+
+    const double* coeffs = reinterpret_cast<const double*>(&m_PacCoeff);
+    std::vector<double> key(coeffs, coeffs + sizeof(PacCoeff) / sizeof(double));
+    key.insert(key.end(), {gamma_max, Fz_max, (double)ns, (double)nc, (double)nl});
+
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        m_tables = cache[key].lock();
+        if (m_tables)
+            return;
+    }
+
+    auto tables = chrono_types::make_shared<Tables>();
+    tables->num_slip = ns;
+    tables->num_camber = nc;
+    tables->num_load = nl;
+    tables->gamma_max = gamma_max;
+    tables->Fz_max = Fz_max;
+    tables->Fx.resize(ns * nl);
+    tables->Fy.resize(ns * nc * nl);
+    tables->Mz.resize(ns * nc * nl);
+
+    // The Magic Formula terms vanish with the load (B is undefined at Fz = 0)
+    for (int k = 1; k < nl; k++) {
+        double Fz = Fz_max * k / (nl - 1);
+        for (int i = 0; i < ns; i++)
+            tables->Fx[k * ns + i] = CalcFx(SlipNode(i, kappa_max, ns), Fz);
+        for (int j = 0; j < nc; j++) {
+            double gamma = gamma_max * (2.0 * j / (nc - 1) - 1);
+            for (int i = 0; i < ns; i++) {
+                double alpha = SlipNode(i, alpha_max, ns);
+                tables->Fy[(k * nc + j) * ns + i] = CalcFy(alpha, gamma, Fz);
+                tables->Mz[(k * nc + j) * ns + i] = CalcMz(alpha, gamma, Fz);
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    m_tables = cache[key].lock();
+    if (!m_tables) {
+        cache[key] = tables;
+        m_tables = tables;
+    }
+}
+
+bool ChPac89Tire::InTables(double gamma, double Fz) const {
+    return Fz <= m_tables->Fz_max && std::abs(gamma) <= m_tables->gamma_max;
+}
+
+double ChPac89Tire::InterpFx(double kappa, double Fz) const {
+    const Tables& tab = *m_tables;
+    int ns = tab.num_slip;
+
+    int i, k;
+    double ti, tk;
+    GridCell(SlipCoordinate(kappa, kappa_max, ns), ns, i, ti);
+    GridCell(Fz / tab.Fz_max * (tab.num_load - 1), tab.num_load, k, tk);
+
+    const double* f0 = &tab.Fx[k * ns + i];
+    const double* f1 = f0 + ns;
+    return (1 - tk) * ((1 - ti) * f0[0] + ti * f0[1]) + tk * ((1 - ti) * f1[0] + ti * f1[1]);
+}
+
+void ChPac89Tire::InterpFyMz(double alpha, double gamma, double Fz, double& Fy, double& Mz) const {
+    const Tables& tab = *m_tables;
+    int ns = tab.num_slip;
+    int nc = tab.num_camber;
+
+    int i, j, k;
+    double ti, tj, tk;
+    GridCell(SlipCoordinate(alpha, alpha_max, ns), ns, i, ti);
+    GridCell(tab.gamma_max > 0 ? (gamma / tab.gamma_max + 1) * 0.5 * (nc - 1) : 0, nc, j, tj);
+    GridCell(Fz / tab.Fz_max * (tab.num_load - 1), tab.num_load, k, tk);
+
+    // Weights and offsets of the 8 cell corners
+    size_t base = (k * nc + j) * ns + i;
+    size_t offset[4] = {0, (size_t)ns, (size_t)(nc * ns), (size_t)(nc * ns + ns)};
+    double weight[4] = {(1 - tk) * (1 - tj), (1 - tk) * tj, tk * (1 - tj), tk * tj};
+
+    Fy = 0;
+    Mz = 0;
+    for (int c = 0; c < 4; c++) {
+        const double* fy = &tab.Fy[base + offset[c]];
+        const double* mz = &tab.Mz[base + offset[c]];
+        Fy += weight[c] * ((1 - ti) * fy[0] + ti * fy[1]);
+        Mz += weight[c] * ((1 - ti) * mz[0] + ti * mz[1]);
+    }
+}
+
+ChPac89Tire::TabulationError ChPac89Tire::CheckTabulation(int num_samples) const {
+    TabulationError error = {0, 0, 0};
+    if (!m_tables)
+        return error;
+
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    double Fx_max = 0, Fy_max = 0, Mz_max = 0;
+    for (int n = 0; n < num_samples; n++) {
+        double kappa = kappa_max * (2 * unit(generator) - 1);
+        double alpha = alpha_max * (2 * unit(generator) - 1);
+        double gamma = m_tables->gamma_max * (2 * unit(generator) - 1);
+        double Fz = m_tables->Fz_max * (1 - unit(generator));  // in (0, Fz_max]
+
+        double Fx = CalcFx(kappa, Fz);
+        double Fy = CalcFy(alpha, gamma, Fz);
+        double Mz = CalcMz(alpha, gamma, Fz);
+        double Fy_tab, Mz_tab;
+        InterpFyMz(alpha, gamma, Fz, Fy_tab, Mz_tab);
+
+        error.Fx = std::max(error.Fx, std::abs(InterpFx(kappa, Fz) - Fx));
+        error.Fy = std::max(error.Fy, std::abs(Fy_tab - Fy));
+        error.Mz = std::max(error.Mz, std::abs(Mz_tab - Mz));
+        Fx_max = std::max(Fx_max, std::abs(Fx));
+        Fy_max = std::max(Fy_max, std::abs(Fy));
+        Mz_max = std::max(Mz_max, std::abs(Mz));
+    }
+
+    if (Fx_max > 0)
+        error.Fx /= Fx_max;
+    if (Fy_max > 0)
+        error.Fy /= Fy_max;
+    if (Mz_max > 0)
+        error.Mz /= Mz_max;
+    return error;
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
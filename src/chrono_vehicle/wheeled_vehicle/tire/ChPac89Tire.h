@@ -19,6 +19,7 @@
 #ifndef CH_PAC89TIRE_H
 #define CH_PAC89TIRE_H
 
+#include <memory>
 #include <vector>
 
 #include "chrono/physics/ChBody.h"
@@ -87,6 +88,37 @@ class CH_VEHICLE_API ChPac89Tire : public ChTire {
     /// The reported value will be similar to that reported by ChTire::GetCamberAngle.
     double GetCamberAngle_internal() { return m_gamma * CH_C_DEG_TO_RAD; }
 
+    /// Evaluate the pure-slip Magic Formula terms by interpolation in tables precomputed at initialization,
+    /// instead of evaluating the formulas at each step (default: analytic evaluation).
+    /// The tables cover the full ranges of longitudinal slip and slip angle, camber angles up to the camber
+    /// limit, and vertical loads up to max_load (in N). Slip grid points are clustered around zero slip.
+    /// Outside the tabulated load and camber ranges, the analytic formulas are used. Since the fitted formulas
+    /// may vary rapidly at loads well above the operating range, max_load should not be chosen much larger than
+    /// the expected peak load; use CheckTabulation to verify the accuracy of the selected resolution.
+    /// Tires with identical parameters and table resolutions share the same tables.
+    void EnableTabulation(double max_load,     ///< largest tabulated vertical load [N]
+                          int num_slip = 101,  ///< number of grid points for longitudinal slip and slip angle
+                          int num_camber = 5,  ///< number of grid points for camber angle
+                          int num_load = 21    ///< number of grid points for vertical load
+    );
+
+    /// Revert to analytic evaluation of the Magic Formula.
+    void DisableTabulation();
+
+    /// Return true if the Magic Formula is evaluated from precomputed tables.
+    bool IsTabulated() const { return m_tables != nullptr; }
+
+    /// Errors of the tabulated Magic Formula, relative to the largest analytic value over the sample set.
+    struct TabulationError {
+        double Fx;  ///< longitudinal force
+        double Fy;  ///< lateral force
+        double Mz;  ///< self-aligning torque
+    };
+
+    /// Compare the tabulated and analytic Magic Formula terms at random points of the tabulated range and
+    /// return the largest relative errors. Tabulation must be enabled and the tire initialized.
+    TabulationError CheckTabulation(int num_samples = 10000) const;
+
   protected:
     /// Return the vertical tire stiffness contribution to the normal force.
     virtual double GetNormalStiffnessForce(double depth) const = 0;
@@ -212,6 +244,36 @@ class CH_VEHICLE_API ChPac89Tire : public ChTire {
 
     std::shared_ptr<ChCylinderShape> m_cyl_shape;  ///< visualization cylinder asset
     std::shared_ptr<ChTexture> m_texture;          ///< visualization texture asset
+
+  private:
+    /// Tabulated pure-slip Magic Formula terms.
+    /// Forces and moments are tabulated without friction scaling and vertical shifts.
+    struct Tables {
+        int num_slip;
+        int num_camber;
+        int num_load;
+        double gamma_max;        ///< camber range [-gamma_max, gamma_max] (degrees)
+        double Fz_max;           ///< load range [0, Fz_max] (kN)
+        std::vector<double> Fx;  ///< Fx(kappa, Fz), kappa fastest
+        std::vector<double> Fy;  ///< Fy(alpha, gamma, Fz), alpha fastest
+        std::vector<double> Mz;  ///< Mz(alpha, gamma, Fz), alpha fastest
+    };
+
+    double CalcFx(double kappa, double Fz) const;
+    double CalcFy(double alpha, double gamma, double Fz) const;
+    double CalcMz(double alpha, double gamma, double Fz) const;
+
+    void BuildTables();
+    bool InTables(double gamma, double Fz) const;
+    double InterpFx(double kappa, double Fz) const;
+    void InterpFyMz(double alpha, double gamma, double Fz, double& Fy, double& Mz) const;
+
+    bool m_tabulate;
+    double m_tab_max_load;
+    int m_tab_num_slip;
+    int m_tab_num_camber;
+    int m_tab_num_load;
+    std::shared_ptr<const Tables> m_tables;
 };
 
 /// @} vehicle_wheeled_tire
@@ -440,18 +440,20 @@ void ChPacejkaTire::update_W_frame(const ChTerrain& terrain) {
 
     double depth;
     double dum_cam;
+    // Terrain used for collision detection (local heightfield snapshot, if enabled)
+    const ChTerrain& collision_terrain = GetCollisionTerrain(terrain, m_tireState.pos);
     switch (m_collision_type) {
         case CollisionType::SINGLE_POINT:
-            m_in_contact =
-                DiscTerrainCollision(terrain, m_tireState.pos, m_tireState.rot.GetYaxis(), m_R0, contact_frame, depth);
+            m_in_contact = DiscTerrainCollision(collision_terrain, m_tireState.pos, m_tireState.rot.GetYaxis(), m_R0,
+                                                contact_frame, depth);
             break;
         case CollisionType::FOUR_POINTS:
-            m_in_contact = DiscTerrainCollision4pt(terrain, m_tireState.pos, m_tireState.rot.GetYaxis(), m_R0,
+            m_in_contact = DiscTerrainCollision4pt(collision_terrain, m_tireState.pos, m_tireState.rot.GetYaxis(), m_R0,
                                                    m_params->dimension.width, contact_frame, depth, dum_cam);
             break;
         case CollisionType::ENVELOPE:
-            m_in_contact = DiscTerrainCollisionEnvelope(terrain, m_tireState.pos, m_tireState.rot.GetYaxis(), m_R0,
-                                                        m_areaDep, contact_frame, depth);
+            m_in_contact = DiscTerrainCollisionEnvelope(collision_terrain, m_tireState.pos, m_tireState.rot.GetYaxis(),
+                                                        m_R0, m_areaDep, contact_frame, depth);
             break;
     }
 
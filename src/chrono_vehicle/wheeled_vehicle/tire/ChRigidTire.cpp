@@ -25,6 +25,7 @@
 #include "chrono_vehicle/wheeled_vehicle/tire/ChRigidTire.h"
 
 #include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
+#include "chrono_vehicle/utils/ChVehicleDataCache.h"
 
 namespace chrono {
 namespace vehicle {
@@ -61,8 +62,8 @@ void ChRigidTire::Initialize(std::shared_ptr<ChWheel> wheel) {
 
     if (m_use_contact_mesh) {
         // Mesh contact
-        m_trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
-        m_trimesh->LoadWavefrontMesh(m_contact_meshFile, true, false);
+        m_trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>(
+            *LoadMeshWavefront(m_contact_meshFile, true, false));
 
         //// RADU
         // Hack to deal with current limitation: cannot set offset on a trimesh collision shape!
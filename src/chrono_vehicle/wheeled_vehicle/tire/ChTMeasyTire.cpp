@@ -143,20 +143,24 @@ void ChTMeasyTire::Synchronize(double time, const ChTerrain& terrain) {
     ChMatrix33<> A(wheel_state.rot);
     ChVector<> disc_normal = A.Get_A_Yaxis();
 
+    // Terrain used for collision detection (local heightfield snapshot, if enabled)
+    const ChTerrain& collision_terrain = GetCollisionTerrain(terrain, wheel_state.pos);
+
     // Assuming the tire is a disc, check contact with terrain
     switch (m_collision_type) {
         case CollisionType::SINGLE_POINT:
-            m_data.in_contact = DiscTerrainCollision(terrain, wheel_state.pos, disc_normal, m_unloaded_radius,
+            m_data.in_contact = DiscTerrainCollision(collision_terrain, wheel_state.pos, disc_normal, m_unloaded_radius,
                                                      m_data.frame, m_data.depth);
             m_gamma = GetCamberAngle();
             break;
         case CollisionType::FOUR_POINTS:
-            m_data.in_contact = DiscTerrainCollision4pt(terrain, wheel_state.pos, disc_normal, m_unloaded_radius,
-                                                        m_width, m_data.frame, m_data.depth, m_gamma);
+            m_data.in_contact =
+                DiscTerrainCollision4pt(collision_terrain, wheel_state.pos, disc_normal, m_unloaded_radius, m_width,
+                                        m_data.frame, m_data.depth, m_gamma);
             break;
         case CollisionType::ENVELOPE:
-            m_data.in_contact = DiscTerrainCollisionEnvelope(terrain, wheel_state.pos, disc_normal, m_unloaded_radius,
-                                                             m_areaDep, m_data.frame, m_data.depth);
+            m_data.in_contact = DiscTerrainCollisionEnvelope(collision_terrain, wheel_state.pos, disc_normal,
+                                                             m_unloaded_radius, m_areaDep, m_data.frame, m_data.depth);
             m_gamma = GetCamberAngle();
             break;
     }
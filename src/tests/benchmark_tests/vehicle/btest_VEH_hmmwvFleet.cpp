@@ -0,0 +1,125 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for a fleet of independent HMMWV double lane change variants
+// (different target speeds), advanced concurrently by a ChVehicleFleet with an
+// increasing number of worker threads.
+//
+// =============================================================================
+
+#include <iostream>
+#include <memory>
+
+#include "benchmark/benchmark.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/driver/ChPathFollowerDriver.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/utils/ChVehicleFleet.h"
+#include "chrono_vehicle/utils/ChVehiclePath.h"
+
+#include "chrono_models/vehicle/hmmwv/HMMWV.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+// =============================================================================
+
+class HmmwvDlcMember : public ChFleetMember {
+  public:
+    HmmwvDlcMember(double target_speed);
+
+    virtual double GetChTime() const override { return m_hmmwv->GetSystem()->GetChTime(); }
+    virtual void ExecuteStep(double step) override;
+
+  private:
+    std::unique_ptr<HMMWV_Full> m_hmmwv;
+    std::unique_ptr<RigidTerrain> m_terrain;
+    std::unique_ptr<ChPathFollowerDriver> m_driver;
+};
+
+HmmwvDlcMember::HmmwvDlcMember(double target_speed) {
+    m_hmmwv = std::unique_ptr<HMMWV_Full>(new HMMWV_Full());
+    m_hmmwv->SetContactMethod(ChContactMethod::SMC);
+    m_hmmwv->SetChassisFixed(false);
+    m_hmmwv->SetInitPosition(ChCoordsys<>(ChVector<>(-120, 0, 0.7), ChQuaternion<>(1, 0, 0, 0)));
+    m_hmmwv->SetPowertrainType(PowertrainModelType::SHAFTS);
+    m_hmmwv->SetDriveType(DrivelineType::AWD);
+    m_hmmwv->SetTireType(TireModelType::TMEASY);
+    m_hmmwv->SetTireStepSize(1e-3);
+    m_hmmwv->SetAerodynamicDrag(0.5, 5.0, 1.2);
+    m_hmmwv->Initialize();
+
+    m_terrain = std::unique_ptr<RigidTerrain>(new RigidTerrain(m_hmmwv->GetSystem()));
+    auto patch_material = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    patch_material->SetFriction(0.9f);
+    patch_material->SetRestitution(0.01f);
+    patch_material->SetYoungModulus(2e7f);
+    m_terrain->AddPatch(patch_material, ChVector<>(0, 0, 0), ChVector<>(0, 0, 1), 300, 20);
+    m_terrain->Initialize();
+
+    auto path = DoubleLaneChangePath(ChVector<>(-125, 0, 0.1), 28.93, 3.6105, 25.0, 50.0, false);
+    m_driver = std::unique_ptr<ChPathFollowerDriver>(
+        new ChPathFollowerDriver(m_hmmwv->GetVehicle(), path, "my_path", target_speed));
+    m_driver->GetSteeringController().SetLookAheadDistance(5.0);
+    m_driver->GetSteeringController().SetGains(0.8, 0, 0);
+    m_driver->GetSpeedController().SetGains(0.4, 0, 0);
+    m_driver->Initialize();
+}
+
+void HmmwvDlcMember::ExecuteStep(double step) {
+    double time = m_hmmwv->GetSystem()->GetChTime();
+
+    ChDriver::Inputs driver_inputs = m_driver->GetInputs();
+
+    m_driver->Synchronize(time);
+    m_terrain->Synchronize(time);
+    m_hmmwv->Synchronize(time, driver_inputs, *m_terrain);
+
+    m_driver->Advance(step);
+    m_terrain->Advance(step);
+    m_hmmwv->Advance(step);
+}
+
+// =============================================================================
+
+#define NUM_MEMBERS 16  // number of maneuver variants
+#define END_TIME 2.0    // simulated time for each variant
+#define STEP_SIZE 2e-3  // vehicle step size
+
+static void HmmwvDLC_Fleet(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        ChVehicleFleet fleet;
+        fleet.SetNumThreads((int)state.range(0));
+        for (int i = 0; i < NUM_MEMBERS; i++)
+            fleet.AddMember(std::make_shared<HmmwvDlcMember>(10.0 + 0.5 * i));
+        state.ResumeTiming();
+
+        int num_ok = fleet.Run(END_TIME, STEP_SIZE);
+
+        state.PauseTiming();
+        double member_time = 0;
+        for (const auto& member : fleet.GetMembers())
+            member_time += member->GetWallTime();
+        state.counters["failed"] = NUM_MEMBERS - num_ok;
+        state.counters["member_time"] = member_time / NUM_MEMBERS;
+        state.counters["speedup"] = member_time / fleet.GetWallTime();
+        fleet.WriteReport(std::cout);
+        state.ResumeTiming();
+    }
+}
+
+BENCHMARK(HmmwvDLC_Fleet)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->Iterations(1);
+
+BENCHMARK_MAIN();
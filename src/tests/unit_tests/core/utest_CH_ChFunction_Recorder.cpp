@@ -0,0 +1,86 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for ChFunction_Recorder
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/motion_functions/ChFunction_Recorder.h"
+
+using namespace chrono;
+
+// Piecewise linear reference: f(x) = x^2 interpolated at the given abscissas
+static double Reference(const std::vector<double>& xp, double x) {
+    if (x <= xp.front())
+        return xp.front() * xp.front();
+    if (x >= xp.back())
+        return xp.back() * xp.back();
+    size_t i = 0;
+    while (x > xp[i + 1])
+        i++;
+    double t = (x - xp[i]) / (xp[i + 1] - xp[i]);
+    return (1 - t) * xp[i] * xp[i] + t * xp[i + 1] * xp[i + 1];
+}
+
+TEST(ChFunctionRecorderTest, unordered_insertion) {
+    std::vector<double> xp = {-1.0, -0.3, 0.0, 0.2, 0.25, 1.0, 1.7, 3.0};
+
+    ChFunction_Recorder fun;
+    for (int i : {4, 0, 7, 2, 5, 1, 6, 3})
+        fun.AddPoint(xp[i], xp[i] * xp[i]);
+    fun.AddPoint(0.2, 0.04);  // overwrite an existing point
+
+    ASSERT_EQ(fun.GetPoints().size(), xp.size());
+    ASSERT_FALSE(fun.IsUniform());
+    for (size_t i = 0; i < xp.size(); i++)
+        ASSERT_EQ(fun.GetPoints()[i].x, xp[i]);
+
+    size_t cursor = 0;
+    for (double x = -1.5; x < 3.5; x += 0.01) {
+        ASSERT_NEAR(fun.Get_y(x), Reference(xp, x), 1e-12);
+        ASSERT_NEAR(fun.Get_y(x, cursor), Reference(xp, x), 1e-12);
+    }
+    for (double x = 3.5; x > -1.5; x -= 0.37)
+        ASSERT_NEAR(fun.Get_y(x, cursor), Reference(xp, x), 1e-12);
+}
+
+TEST(ChFunctionRecorderTest, uniform) {
+    std::vector<double> xp;
+    ChFunction_Recorder fun;
+    for (int i = 0; i <= 100; i++) {
+        xp.push_back(-2 + 0.1 * i);
+        fun.AddPoint(xp.back(), xp.back() * xp.back());
+    }
+    ASSERT_TRUE(fun.IsUniform());
+
+    std::vector<double> x;
+    for (double v = -3; v < 10; v += 0.013)
+        x.push_back(v);
+    x.push_back(-2);
+    x.push_back(8);
+
+    std::vector<double> y;
+    fun.Get_y(x, y);
+    ASSERT_EQ(y.size(), x.size());
+    for (size_t i = 0; i < x.size(); i++)
+        ASSERT_NEAR(y[i], Reference(xp, x[i]), 1e-12);
+
+    // Inserting a point in the middle makes the table non-uniform
+    fun.AddPoint(0.05, 0.05 * 0.05);
+    ASSERT_FALSE(fun.IsUniform());
+    ASSERT_NEAR(fun.Get_y(0.04), 0.8 * 0.05 * 0.05, 1e-12);
+}
@@ -0,0 +1,123 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the analytic derivatives of composite functions
+// (ChFunction_Operation, ChFunction_Mirror, ChFunction_Repeat, ChFunction_Sequence)
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/motion_functions/ChFunction_Const.h"
+#include "chrono/motion_functions/ChFunction_Mirror.h"
+#include "chrono/motion_functions/ChFunction_Operation.h"
+#include "chrono/motion_functions/ChFunction_Poly.h"
+#include "chrono/motion_functions/ChFunction_Ramp.h"
+#include "chrono/motion_functions/ChFunction_Repeat.h"
+#include "chrono/motion_functions/ChFunction_Sequence.h"
+#include "chrono/motion_functions/ChFunction_Sine.h"
+
+using namespace chrono;
+
+static std::shared_ptr<ChFunction_Operation> MakeOperation(ChFunction_Operation::eChOperation op,
+                                                           std::shared_ptr<ChFunction> fa,
+                                                           std::shared_ptr<ChFunction> fb) {
+    auto f = chrono_types::make_shared<ChFunction_Operation>();
+    f->Set_optype(op);
+    f->Set_fa(fa);
+    f->Set_fb(fb);
+    return f;
+}
+
+// Check the fused and separate evaluations against the expected value and derivatives
+static void Check(const ChFunction& f, double x, double y, double y_dx, double y_dxdx) {
+    double tol = 1e-9 * (1 + std::abs(y) + std::abs(y_dx) + std::abs(y_dxdx));
+    ASSERT_NEAR(f.Get_y(x), y, tol);
+    ASSERT_NEAR(f.Get_y_dx(x), y_dx, tol);
+    ASSERT_NEAR(f.Get_y_dxdx(x), y_dxdx, tol);
+
+    double v, v_dx, v_dxdx;
+    f.Get_y_all(x, v, v_dx, v_dxdx);
+    ASSERT_NEAR(v, y, tol);
+    ASSERT_NEAR(v_dx, y_dx, tol);
+    ASSERT_NEAR(v_dxdx, y_dxdx, tol);
+}
+
+TEST(ChFunctionDerivativesTest, operation) {
+    // s(x) = 2 sin(3x + 0.5), r(x) = 1 + 0.5x
+    auto s = chrono_types::make_shared<ChFunction_Sine>(0.5, 3 / CH_C_2PI, 2);
+    auto r = chrono_types::make_shared<ChFunction_Ramp>(1, 0.5);
+
+    auto mul = MakeOperation(ChFunction_Operation::ChOP_MUL, s, r);
+    auto div = MakeOperation(ChFunction_Operation::ChOP_DIV, s, r);
+    auto pow = MakeOperation(ChFunction_Operation::ChOP_POW, r, s);
+    auto fun = MakeOperation(ChFunction_Operation::ChOP_FUNCT, s, r);
+
+    for (double x = 0; x < 2; x += 0.13) {
+        double sv = 2 * std::sin(3 * x + 0.5);
+        double s1 = 6 * std::cos(3 * x + 0.5);
+        double s2 = -9 * sv;
+        double rv = 1 + 0.5 * x;
+        double r1 = 0.5;
+
+        Check(*mul, x, sv * rv, s1 * rv + sv * r1, s2 * rv + 2 * s1 * r1);
+
+        double q = sv / rv;
+        double q1 = (s1 - q * r1) / rv;
+        Check(*div, x, q, q1, (s2 - 2 * q1 * r1) / rv);
+
+        // r^s = exp(s ln r)
+        double g1 = s1 * std::log(rv) + sv * r1 / rv;
+        double g2 = s2 * std::log(rv) + 2 * s1 * r1 / rv - sv * r1 * r1 / (rv * rv);
+        double p = std::pow(rv, sv);
+        Check(*pow, x, p, p * g1, p * (g2 + g1 * g1));
+
+        // s(r(x))
+        double u = 3 * rv + 0.5;
+        Check(*fun, x, 2 * std::sin(u), 6 * std::cos(u) * r1, -18 * std::sin(u) * r1 * r1);
+    }
+}
+
+TEST(ChFunctionDerivativesTest, mirror_repeat) {
+    // p(x) = x^3
+    auto p = chrono_types::make_shared<ChFunction_Poly>();
+    p->Set_order(3);
+    p->Set_coeff(1, 3);
+
+    auto mirror = chrono_types::make_shared<ChFunction_Mirror>();
+    mirror->Set_fa(p);
+    mirror->Set_mirror_axis(1);
+    Check(*mirror, 0.5, 0.125, 0.75, 3);
+    Check(*mirror, 1.5, 0.125, -0.75, 3);
+
+    auto repeat = chrono_types::make_shared<ChFunction_Repeat>();
+    repeat->Set_fa(p);
+    repeat->Set_window_length(2);
+    Check(*repeat, 2.5, 0.125, 0.75, 3);
+}
+
+TEST(ChFunctionDerivativesTest, sequence) {
+    auto seq = chrono_types::make_shared<ChFunction_Sequence>();
+    seq->InsertFunct(chrono_types::make_shared<ChFunction_Ramp>(0, 2), 1, 1, true);
+    seq->InsertFunct(chrono_types::make_shared<ChFunction_Sine>(0, 0.5, 1), 1, 1, true);
+    seq->Setup();
+
+    for (double x = 0.05; x < 2; x += 0.1) {
+        double y, y_dx, y_dxdx;
+        seq->Get_y_all(x, y, y_dx, y_dxdx);
+        ASSERT_DOUBLE_EQ(y, seq->Get_y(x));
+        ASSERT_DOUBLE_EQ(y_dx, seq->Get_y_dx(x));
+        ASSERT_DOUBLE_EQ(y_dxdx, seq->Get_y_dxdx(x));
+    }
+}
@@ -66,3 +66,22 @@ TEST(ChQuaternionTest, multiply) {
     qf >>= q2f;
     TestEqualFloat(q2f * q1f, qf);
 }
+
+TEST(ChQuaternionTest, multiply_aliased) {
+    ChQuaternion<double> q1d(0.3, -0.5, 0.7, 0.1);
+    ChQuaternion<double> q2d(-0.2, 0.4, 0.9, -0.6);
+    ChQuaternion<double> ref = Qcross(q1d, q2d);
+
+    // The product must be correct when an operand is also the result
+    ChQuaternion<double> qd = q1d;
+    qd.Cross(qd, q2d);
+    ASSERT_TRUE(qd.Equals(ref, 1e-15));
+
+    qd = q2d;
+    qd.Cross(q1d, qd);
+    ASSERT_TRUE(qd.Equals(ref, 1e-15));
+
+    qd = q1d;
+    qd.Cross(qd, qd);
+    ASSERT_TRUE(qd.Equals(Qcross(q1d, q1d), 1e-15));
+}
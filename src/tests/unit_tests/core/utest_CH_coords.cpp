@@ -17,6 +17,7 @@
 // =============================================================================
 
 #include <cmath>
+#include <vector>
 
 #include "chrono/core/ChLog.h"
 #include "chrono/core/ChTransform.h"
@@ -236,3 +237,43 @@ TEST(CoordsTest, global_to_local_3frames) {
     cout << mvect1 << " ..inv three transf (another method) \n";
     check_vector(mvect1, mvect1_ref, ABS_ERR);
 }
+
+TEST(CoordsTest, batched) {
+    ChFrame<> frameA(ChVector<>(5, 6, 7), Q_from_AngAxis(0.7, ChVector<>(1, 3, 4).GetNormalized()));
+    ChFrame<> frameB(ChVector<>(-1, 2, 0.5), Q_from_AngAxis(-1.3, ChVector<>(2, -1, 1).GetNormalized()));
+
+    // Cover both the blocks of four points and the remainder loop
+    for (size_t n : {0, 1, 3, 4, 5, 8, 11, 100}) {
+        std::vector<ChVector<>> local(n);
+        for (size_t i = 0; i < n; i++)
+            local[i] = ChVector<>(0.1 * i, 2.0 - 0.3 * i, std::sin(1.0 * i));
+
+        std::vector<ChVector<>> parent;
+        frameA.TransformPointsLocalToParent(local, parent);
+        ASSERT_EQ(parent.size(), n);
+        for (size_t i = 0; i < n; i++)
+            check_vector(parent[i], frameA.TransformPointLocalToParent(local[i]), ABS_ERR);
+
+        std::vector<ChVector<>> directions;
+        frameA.TransformDirectionsLocalToParent(local, directions);
+        for (size_t i = 0; i < n; i++)
+            check_vector(directions[i], frameA.TransformDirectionLocalToParent(local[i]), ABS_ERR);
+
+        // In place
+        std::vector<ChVector<>> points = parent;
+        frameA.TransformPointsParentToLocal(points, points);
+        for (size_t i = 0; i < n; i++)
+            check_vector(points[i], local[i], ABS_ERR);
+
+        std::vector<ChFrame<>> frames(n);
+        for (size_t i = 0; i < n; i++)
+            frames[i] = ChFrame<>(local[i], Q_from_AngZ(0.2 * i));
+        std::vector<ChFrame<>> composed;
+        frameB.TransformFramesLocalToParent(frames, composed);
+        for (size_t i = 0; i < n; i++) {
+            ChFrame<> ref = frameB * frames[i];
+            check_vector(composed[i].GetPos(), ref.GetPos(), ABS_ERR);
+            ASSERT_TRUE(composed[i].GetRot().Equals(ref.GetRot(), ABS_ERR));
+        }
+    }
+}
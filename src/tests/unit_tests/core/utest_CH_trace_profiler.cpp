@@ -0,0 +1,85 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the trace profiler: zones recorded from several threads are
+// exported as Chrome trace events and as folded stacks.
+//
+// =============================================================================
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "chrono/utils/ChTraceProfiler.h"
+
+using namespace chrono::utils;
+
+static void Work(int n) {
+    CH_PROFILE_ZONE("outer");
+    for (int i = 0; i < n; i++) {
+        CH_PROFILE_ZONE("inner");
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
+
+static std::string ReadFile(const std::string& filename) {
+    std::ifstream ifs(filename);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    return ss.str();
+}
+
+TEST(ChTraceProfiler, disabled) {
+    ChTraceProfiler::Enable(false);
+    ChTraceProfiler::Reset();
+    Work(3);
+    ASSERT_EQ(ChTraceProfiler::GetNumEvents(), 0);
+}
+
+TEST(ChTraceProfiler, threads) {
+    ChTraceProfiler::Reset();
+    ChTraceProfiler::Enable(true);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++)
+        threads.emplace_back([]() { Work(5); });
+    for (auto& thread : threads)
+        thread.join();
+    Work(2);
+
+    ChTraceProfiler::Enable(false);
+    Work(2);
+
+    // 4 threads x (1 outer + 5 inner) + main thread x (1 outer + 2 inner)
+    ASSERT_EQ(ChTraceProfiler::GetNumEvents(), 27);
+
+    ASSERT_TRUE(ChTraceProfiler::WriteChromeTrace("trace_profiler.json"));
+    std::string trace = ReadFile("trace_profiler.json");
+    ASSERT_EQ(trace.find("{\"traceEvents\":["), 0);
+    ASSERT_NE(trace.find("\"name\":\"inner\",\"ph\":\"X\""), std::string::npos);
+
+    ASSERT_TRUE(ChTraceProfiler::WriteFoldedStacks("trace_profiler.folded"));
+    std::istringstream folded(ReadFile("trace_profiler.folded"));
+    std::string path;
+    long long self_time;
+    long long inner_time = 0;
+    while (folded >> path >> self_time) {
+        ASSERT_TRUE(path == "outer" || path == "outer;inner");
+        if (path == "outer;inner")
+            inner_time = self_time;
+    }
+    // 22 inner zones of at least 100 us each
+    ASSERT_GE(inner_time, 2200);
+}
@@ -0,0 +1,193 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Tests for the shared memory co-simulation channel (POSIX only).
+// A forked client exchanges messages with the server through small rings, to
+// exercise wrap-around and batched writes. Other tests check the timeouts and
+// the rejection of invalid segments, corrupted messages, and closed peers.
+//
+// =============================================================================
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono_cosimulation/ChExceptionSocket.h"
+#include "chrono_cosimulation/ChSharedMemoryChannel.h"
+
+using namespace chrono::cosimul;
+
+// Segment name unique to this process and test
+static std::string SegmentName(const std::string& test) {
+    return "utest_COSIM_" + test + "_" + std::to_string(getpid());
+}
+
+TEST(ChSharedMemoryChannel, ping_pong) {
+    const int num_trips = 20000;
+    const uint32_t count = 37;
+    std::string name = SegmentName("ping_pong");
+
+    ChSharedMemoryChannel server;
+    server.Create(name, 4096);
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        // Client: reply to each message with two messages published by a single flush
+        int errors = 0;
+        try {
+            ChSharedMemoryChannel client;
+            client.Open(name);
+            std::vector<double> values;
+            uint32_t type;
+            double time;
+            for (int i = 0; i < num_trips; i++) {
+                if (!client.Receive(type, time, values, 10))
+                    _exit(2);
+                if (type != 1 || values.size() != count)
+                    errors++;
+                for (auto& v : values)
+                    v *= 2;
+                client.Write(2, time, values.data(), count);
+                client.Write(3, time, values.data(), 1);
+                client.Flush();
+            }
+        } catch (ChExceptionSocket&) {
+            _exit(3);
+        }
+        _exit(errors == 0 ? 0 : 1);
+    }
+
+    ASSERT_TRUE(server.WaitConnection(10));
+
+    std::vector<double> out(count);
+    std::vector<double> in;
+    uint32_t type;
+    double time;
+    int errors = 0;
+    for (int i = 0; i < num_trips; i++) {
+        for (uint32_t k = 0; k < count; k++)
+            out[k] = i + k;
+        server.Send(1, i * 1e-3, out.data(), count);
+
+        ASSERT_TRUE(server.Receive(type, time, in, 10));
+        if (type != 2 || in.size() != count || in[5] != 2.0 * (i + 5) || time != i * 1e-3)
+            errors++;
+        ASSERT_TRUE(server.Receive(type, time, in, 10));
+        if (type != 3 || in.size() != 1 || in[0] != 2.0 * i)
+            errors++;
+    }
+
+    int status;
+    waitpid(pid, &status, 0);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+    ASSERT_EQ(errors, 0);
+}
+
+TEST(ChSharedMemoryChannel, timeouts) {
+    std::string name = SegmentName("timeouts");
+    ChSharedMemoryChannel server;
+    server.Create(name, 256);
+
+    // No client
+    ASSERT_FALSE(server.WaitConnection(0.05));
+
+    // Nothing to receive
+    uint32_t type;
+    double time;
+    std::vector<double> values;
+    ASSERT_FALSE(server.Receive(type, time, values, 0.05));
+
+    // Full ring with no reader: the writer gives up instead of spinning forever
+    std::vector<double> data(14, 1.0);  // 128 bytes per message
+    ASSERT_TRUE(server.Write(1, 0, data.data(), 14, 0.05));
+    ASSERT_TRUE(server.Write(1, 0, data.data(), 14, 0.05));
+    ASSERT_FALSE(server.Write(1, 0, data.data(), 14, 0.05));
+    ASSERT_FALSE(server.Send(1, 0, data.data(), 14, 0.05));
+}
+
+TEST(ChSharedMemoryChannel, invalid_segment) {
+    ASSERT_THROW(ChSharedMemoryChannel().Open(SegmentName("missing")), ChExceptionSocket);
+
+    // A segment truncated below the size of its rings must be rejected
+    std::string name = SegmentName("truncated");
+    ChSharedMemoryChannel server;
+    server.Create(name, 4096);
+    int fd = shm_open(("/" + name).c_str(), O_RDWR, 0600);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(ftruncate(fd, 1024), 0);
+    close(fd);
+
+    ChSharedMemoryChannel client;
+    ASSERT_THROW(client.Open(name), ChExceptionSocket);
+    ASSERT_FALSE(client.IsOpen());
+}
+
+TEST(ChSharedMemoryChannel, corrupted_message) {
+    std::string name = SegmentName("corrupted");
+    ChSharedMemoryChannel server;
+    server.Create(name, 1024);
+    ChSharedMemoryChannel client;
+    client.Open(name);
+
+    double value = 1;
+    server.Send(1, 0, &value, 1);
+
+    // Overwrite the value count of the message (segment header, ring positions, then type and count)
+    int fd = shm_open(("/" + name).c_str(), O_RDWR, 0600);
+    ASSERT_GE(fd, 0);
+    char* segment = static_cast<char*>(mmap(nullptr, 256, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+    close(fd);
+    ASSERT_NE(segment, MAP_FAILED);
+    uint32_t count = 1000;
+    std::memcpy(segment + 64 + 128 + 4, &count, 4);
+    munmap(segment, 256);
+
+    uint32_t type;
+    double time;
+    std::vector<double> values;
+    ASSERT_THROW(client.Receive(type, time, values, 1), ChExceptionSocket);
+}
+
+TEST(ChSharedMemoryChannel, closed_peer) {
+    std::string name = SegmentName("closed");
+    ChSharedMemoryChannel server;
+    server.Create(name, 256);
+    {
+        ChSharedMemoryChannel client;
+        client.Open(name);
+        ASSERT_TRUE(server.IsConnected());
+    }
+    ASSERT_FALSE(server.IsConnected());
+
+    // Blocking calls fail instead of waiting for a reader or writer that is gone
+    uint32_t type;
+    double time;
+    std::vector<double> values;
+    ASSERT_THROW(server.Receive(type, time, values), ChExceptionSocket);
+
+    std::vector<double> data(14, 1.0);
+    server.Write(1, 0, data.data(), 14);
+    server.Write(1, 0, data.data(), 14);
+    ASSERT_THROW(server.Write(1, 0, data.data(), 14), ChExceptionSocket);
+
+    // A second client cannot attach to a closed channel
+    ChSharedMemoryChannel client;
+    ASSERT_THROW(client.Open(name), ChExceptionSocket);
+}
@@ -0,0 +1,137 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the ghost exchange of Chrono::Distributed (to be run on 2 MPI ranks).
+// A free body moves with constant velocity across the boundary between the two
+// sub-domains. After every step, exactly one rank must own the body, the other
+// rank must hold a ghost while the body is within a ghost layer of the boundary,
+// and all copies must be at the analytical position.
+//
+// =============================================================================
+
+#include "chrono_distributed/physics/ChSystemDistributed.h"
+#include "chrono_distributed/collision/ChCollisionModelDistributed.h"
+#include "chrono/physics/ChBody.h"
+
+#include <mpi.h>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+using namespace chrono;
+using namespace chrono::collision;
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int my_rank;
+    int num_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+    if (num_ranks != 2) {
+        if (my_rank == 0)
+            printf("utest_DISTR_exchange must be run on 2 MPI ranks\n");
+        MPI_Finalize();
+        return 1;
+    }
+
+    const double dt = 0.001;
+    const double ghost_layer = 1.0;
+    const double boundary = 10.0;  // split between the two sub-domains
+    const ChVector<> pos0(5, 5, 7.5);
+    const ChVector<> vel(0, 0, 2);
+
+    ChSystemDistributed sys(MPI_COMM_WORLD, ghost_layer, 100);
+    sys.GetDomain()->SetSimDomain(0, 10, 0, 10, 0, 20);
+    sys.Set_G_acc(ChVector<>(0, 0, 0));
+
+    auto material = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+
+    auto ball = chrono_types::make_shared<ChBody>(chrono_types::make_shared<ChCollisionModelDistributed>());
+    ball->SetMass(1);
+    ball->SetPos(pos0);
+    ball->SetPos_dt(vel);
+    ball->GetCollisionModel()->ClearModel();
+    ball->GetCollisionModel()->AddSphere(material, 0.2);
+    ball->GetCollisionModel()->BuildModel();
+    ball->SetCollide(true);
+    sys.AddBody(ball);
+    unsigned int gid = ball->GetGid();
+
+    // Move the body from z = 7.5 (rank 0) to z = 12.5 (rank 1)
+    int num_errors = 0;
+    int num_steps = 2500;
+    for (int i = 0; i < num_steps; i++) {
+        sys.DoStepDynamics(dt);
+        double z = pos0.z() + vel.z() * sys.GetChTime();
+
+        int owned = 0;
+        int ghost = 0;
+        int index = sys.ddm->GetLocalIndex(gid);
+        if (index >= 0) {
+            switch (sys.ddm->comm_status[index]) {
+                case distributed::OWNED:
+                case distributed::SHARED_UP:
+                case distributed::SHARED_DOWN:
+                    owned = 1;
+                    break;
+                case distributed::GHOST_UP:
+                case distributed::GHOST_DOWN:
+                    ghost = 1;
+                    break;
+                default:
+                    break;
+            }
+            if ((owned || ghost) && std::abs(sys.Get_bodylist()[index]->GetPos().z() - z) > 1e-6) {
+                printf("Rank %d step %d: body at z = %f, expected %f\n", my_rank, i,
+                       sys.Get_bodylist()[index]->GetPos().z(), z);
+                num_errors++;
+            }
+        }
+
+        int num_owned;
+        int num_ghosts;
+        MPI_Allreduce(&owned, &num_owned, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+        MPI_Allreduce(&ghost, &num_ghosts, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+
+        if (num_owned != 1) {
+            printf("Rank %d step %d: body owned by %d ranks\n", my_rank, i, num_owned);
+            num_errors++;
+        }
+
+        // Allow the body to be one step off the ghost layer bounds when classified
+        double dist = std::abs(z - boundary);
+        double margin = 2 * vel.Length() * dt;
+        if (dist < ghost_layer - margin && num_ghosts != 1) {
+            printf("Rank %d step %d: %d ghosts near the boundary\n", my_rank, i, num_ghosts);
+            num_errors++;
+        } else if (dist > ghost_layer + margin && num_ghosts != 0) {
+            printf("Rank %d step %d: %d ghosts away from the boundary\n", my_rank, i, num_ghosts);
+            num_errors++;
+        }
+    }
+
+    // The body must have migrated to the high rank
+    int index = sys.ddm->GetLocalIndex(gid);
+    bool owner = index >= 0 && sys.ddm->comm_status[index] == distributed::OWNED;
+    if (owner != (my_rank == 1)) {
+        printf("Rank %d: wrong final owner of the body\n", my_rank);
+        num_errors++;
+    }
+
+    int total_errors;
+    MPI_Allreduce(&num_errors, &total_errors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if (my_rank == 0)
+        printf("utest_DISTR_exchange: %d errors\n", total_errors);
+
+    MPI_Finalize();
+    return total_errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,144 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the load balancing of Chrono::Distributed (to be run on 2 MPI ranks).
+// Bodies at rest are added mostly in the upper sub-domain. With load balancing
+// enabled, the boundary between the sub-domains must move up, bodies must
+// migrate to the lower rank, and no body may be lost or duplicated.
+//
+// =============================================================================
+
+#include "chrono_distributed/physics/ChSystemDistributed.h"
+#include "chrono_distributed/collision/ChCollisionModelDistributed.h"
+#include "chrono/physics/ChBody.h"
+
+#include <mpi.h>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// Number of bodies owned by this rank
+static int NumOwned(ChSystemDistributed& sys) {
+    int num_owned = 0;
+    for (uint i = 0; i < sys.data_manager->num_rigid_bodies; i++) {
+        distributed::COMM_STATUS status = sys.ddm->comm_status[i];
+        if (status == distributed::OWNED || status == distributed::SHARED_UP || status == distributed::SHARED_DOWN)
+            num_owned++;
+    }
+    return num_owned;
+}
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int my_rank;
+    int num_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+    if (num_ranks != 2) {
+        if (my_rank == 0)
+            printf("utest_DISTR_rebalance must be run on 2 MPI ranks\n");
+        MPI_Finalize();
+        return 1;
+    }
+
+    const double dt = 0.001;
+    const double ghost_layer = 1.0;
+
+    ChSystemDistributed sys(MPI_COMM_WORLD, ghost_layer, 1000);
+    sys.GetDomain()->SetSimDomain(0, 10, 0, 10, 0, 20);
+    sys.Set_G_acc(ChVector<>(0, 0, 0));
+    sys.SetLoadBalancing(10);
+
+    auto material = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+
+    // Column of separated spheres: 2 below the initial boundary at z = 10, 50 above it
+    int num_bodies = 0;
+    for (int i = 0; i < 52; i++) {
+        double z = (i < 2) ? 2 + 4 * i : 10.1 + 0.2 * (i - 2);
+        auto ball = chrono_types::make_shared<ChBody>(chrono_types::make_shared<ChCollisionModelDistributed>());
+        ball->SetMass(1);
+        ball->SetPos(ChVector<>(5, 5, z));
+        ball->GetCollisionModel()->ClearModel();
+        ball->GetCollisionModel()->AddSphere(material, 0.05);
+        ball->GetCollisionModel()->BuildModel();
+        ball->SetCollide(true);
+        sys.AddBody(ball);
+        num_bodies++;
+    }
+
+    double split0 = sys.GetDomain()->GetSplitPositions()[1];
+    int owned0 = NumOwned(sys);
+
+    int num_errors = 0;
+    for (int i = 0; i < 200; i++) {
+        sys.DoStepDynamics(dt);
+
+        // No body is lost or owned by both ranks
+        int owned = NumOwned(sys);
+        int total_owned;
+        MPI_Allreduce(&owned, &total_owned, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+        if (total_owned != num_bodies) {
+            if (my_rank == 0)
+                printf("Step %d: %d bodies owned, expected %d\n", i, total_owned, num_bodies);
+            num_errors++;
+        }
+    }
+
+    // All ranks must agree on the new boundary, which must have moved toward the loaded rank
+    double split = sys.GetDomain()->GetSplitPositions()[1];
+    double split_min;
+    double split_max;
+    MPI_Allreduce(&split, &split_min, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    MPI_Allreduce(&split, &split_max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    if (split_min != split_max) {
+        printf("Rank %d: inconsistent boundary %f\n", my_rank, split);
+        num_errors++;
+    }
+    if (split <= split0 + ghost_layer) {
+        printf("Rank %d: boundary moved from %f to %f only\n", my_rank, split0, split);
+        num_errors++;
+    }
+
+    // Bodies must have migrated from the upper to the lower rank
+    int owned = NumOwned(sys);
+    if (my_rank == 0 && owned <= owned0) {
+        printf("Rank 0: owns %d bodies, initially %d\n", owned, owned0);
+        num_errors++;
+    }
+    if (my_rank == 1 && owned >= owned0) {
+        printf("Rank 1: owns %d bodies, initially %d\n", owned, owned0);
+        num_errors++;
+    }
+
+    // Every owned body is in the sub-domain of its rank
+    for (uint i = 0; i < sys.data_manager->num_rigid_bodies; i++) {
+        distributed::COMM_STATUS status = sys.ddm->comm_status[i];
+        if (status != distributed::OWNED && status != distributed::SHARED_UP && status != distributed::SHARED_DOWN)
+            continue;
+        ChVector<> pos = sys.Get_bodylist()[i]->GetPos();
+        if (sys.GetDomain()->GetRank(pos) != my_rank) {
+            printf("Rank %d: owns body %u at z = %f\n", my_rank, sys.ddm->global_id[i], pos.z());
+            num_errors++;
+        }
+    }
+
+    int total_errors;
+    MPI_Allreduce(&num_errors, &total_errors, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if (my_rank == 0)
+        printf("utest_DISTR_rebalance: %d errors\n", total_errors);
+
+    MPI_Finalize();
+    return total_errors == 0 ? 0 : 1;
+}
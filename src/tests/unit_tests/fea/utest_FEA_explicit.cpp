@@ -0,0 +1,157 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Tests for the explicit central difference timestepper with lumped mass and
+// for the element stable step size estimates.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/fea/ChElementHexa_8.h"
+#include "chrono/fea/ChElementTetra_4.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+static const double size = 0.1;
+
+static std::shared_ptr<ChContinuumElastic> CreateMaterial() {
+    auto material = chrono_types::make_shared<ChContinuumElastic>();
+    material->Set_E(1e7);
+    material->Set_v(0.3);
+    material->Set_density(1000);
+    return material;
+}
+
+static double WaveSpeed(std::shared_ptr<ChContinuumElastic> material) {
+    double E = material->Get_E();
+    double v = material->Get_v();
+    return std::sqrt(E * (1 - v) / ((1 + v) * (1 - 2 * v) * material->Get_density()));
+}
+
+// Create a mesh with a single tetrahedron (right corner at the origin).
+static std::shared_ptr<ChMesh> CreateTetraMesh(std::shared_ptr<ChContinuumElastic> material,
+                                               std::vector<std::shared_ptr<ChNodeFEAxyz>>& nodes) {
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(0, 0, 0)));
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(size, 0, 0)));
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(0, size, 0)));
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(0, 0, size)));
+    for (auto& node : nodes)
+        mesh->AddNode(node);
+
+    auto element = chrono_types::make_shared<ChElementTetra_4>();
+    element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3]);
+    element->SetMaterial(material);
+    mesh->AddElement(element);
+
+    return mesh;
+}
+
+TEST(ChTimestepperCentralDifference, StableStep) {
+    auto material = CreateMaterial();
+    double speed = WaveSpeed(material);
+
+    // Tetrahedron: minimum height is size / sqrt(3)
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> tnodes;
+    auto tmesh = CreateTetraMesh(material, tnodes);
+    ASSERT_NEAR(tmesh->ComputeStableStepSize(), size / std::sqrt(3.0) / speed, 1e-12);
+
+    // Cube: shortest edge is size
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> hnodes;
+    for (int k = 0; k < 2; k++) {
+        hnodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(0, 0, k * size)));
+        hnodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(size, 0, k * size)));
+        hnodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(size, size, k * size)));
+        hnodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(0, size, k * size)));
+    }
+    auto hexa = chrono_types::make_shared<ChElementHexa_8>();
+    hexa->SetNodes(hnodes[0], hnodes[1], hnodes[2], hnodes[3], hnodes[4], hnodes[5], hnodes[6], hnodes[7]);
+    hexa->SetMaterial(material);
+    ASSERT_NEAR(hexa->ComputeStableStepSize(), size / speed, 1e-12);
+}
+
+TEST(ChTimestepperCentralDifference, FreeFall) {
+    ChSystemNSC system;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    auto mesh = CreateTetraMesh(CreateMaterial(), nodes);
+    system.Add(mesh);
+
+    system.SetTimestepperType(ChTimestepper::Type::CENTRAL_DIFFERENCE);
+    auto integrator = std::static_pointer_cast<ChTimestepperCentralDifference>(system.GetTimestepper());
+    integrator->SetMaxSubstep(0.5 * mesh->ComputeStableStepSize());
+
+    const double step = 1e-3;
+    const int num_steps = 50;
+    for (int i = 0; i < num_steps; i++)
+        system.DoStepDynamics(step);
+
+    // Rigid translation: no internal forces, the velocity form of the central difference
+    // scheme gives a displacement g * h^2 * n * (n + 1) / 2 after n substeps of size h.
+    int n = num_steps * integrator->GetNumSubsteps();
+    double h = step / integrator->GetNumSubsteps();
+    ASSERT_GT(integrator->GetNumSubsteps(), 1);
+    double disp = system.Get_G_acc().y() * h * h * n * (n + 1) / 2;
+    for (auto& node : nodes) {
+        ASSERT_NEAR(node->GetPos().y() - node->GetX0().y(), disp, 1e-6 * std::abs(disp));
+        ASSERT_NEAR(node->GetPos_dt().y(), system.Get_G_acc().y() * n * h, 1e-9);
+    }
+}
+
+TEST(ChTimestepperCentralDifference, Oscillation) {
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, 0, 0));
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    auto mesh = CreateTetraMesh(CreateMaterial(), nodes);
+    system.Add(mesh);
+
+    // Fix three nodes and set an initial velocity on the fourth one
+    for (int i = 0; i < 3; i++)
+        nodes[i]->SetFixed(true);
+    const double v0 = 0.1;
+    nodes[3]->SetPos_dt(ChVector<>(0, 0, v0));
+
+    system.SetTimestepperType(ChTimestepper::Type::CENTRAL_DIFFERENCE);
+    auto integrator = std::static_pointer_cast<ChTimestepperCentralDifference>(system.GetTimestepper());
+    double h_crit = mesh->ComputeStableStepSize();
+    integrator->SetMaxSubstep(0.5 * h_crit);
+
+    // Below the critical step the oscillation stays bounded (amplitude of order v0 * h_crit)
+    double max_disp = 0;
+    for (int i = 0; i < 1000; i++) {
+        system.DoStepDynamics(h_crit);
+        max_disp = std::max(max_disp, (nodes[3]->GetPos() - nodes[3]->GetX0()).Length());
+    }
+    ASSERT_GT(max_disp, 0.0);
+    ASSERT_LT(max_disp, 10 * v0 * h_crit);
+    ASSERT_LT(nodes[3]->GetPos_dt().Length(), 2 * v0);
+}
+
+TEST(ChTimestepperCentralDifference, Constraints) {
+    ChSystemNSC system;
+    auto body1 = chrono_types::make_shared<ChBody>();
+    auto body2 = chrono_types::make_shared<ChBody>();
+    system.AddBody(body1);
+    system.AddBody(body2);
+    auto link = chrono_types::make_shared<ChLinkLockSpherical>();
+    link->Initialize(body1, body2, ChCoordsys<>());
+    system.AddLink(link);
+
+    system.SetTimestepperType(ChTimestepper::Type::CENTRAL_DIFFERENCE);
+    ASSERT_THROW(system.DoStepDynamics(1e-3), ChException);
+}
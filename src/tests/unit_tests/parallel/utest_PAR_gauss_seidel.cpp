@@ -0,0 +1,103 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the graph-colored projected Gauss-Seidel solver of Chrono::Parallel.
+// A pile of balls settles in a container, once with a single thread and once with
+// several threads. The contact force on the container must balance the total
+// weight and, since contacts of one color are independent, both runs must agree.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+
+static void CreatePile(ChSystemParallelNSC& system,
+                       int num_threads,
+                       std::vector<std::shared_ptr<ChBody>>& balls,
+                       std::shared_ptr<ChBody>& ground) {
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.SetNumThreads(num_threads);
+    system.GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    system.GetSettings()->solver.max_iteration_normal = 0;
+    system.GetSettings()->solver.max_iteration_sliding = 100;
+    system.GetSettings()->solver.max_iteration_spinning = 0;
+    system.GetSettings()->solver.tolerance = 1e-5;
+    system.ChangeSolverType(SolverType::GAUSS_SEIDEL);
+
+    auto material = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    material->SetFriction(0.4f);
+
+    // A 3x3 bottom layer and a 2x2 top layer resting in the pockets of the bottom one
+    double radius = 0.5;
+    double mass = 5;
+    double spacing = 2.1 * radius;
+    for (int layer = 0; layer < 2; layer++) {
+        int n = 3 - layer;
+        double y = (layer == 0) ? 1.02 * radius : 2.6 * radius;
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                auto ball = std::shared_ptr<ChBody>(system.NewBody());
+                ball->SetMass(mass);
+                ball->SetInertiaXX(0.4 * mass * radius * radius * ChVector<>(1, 1, 1));
+                ball->SetPos(ChVector<>((i - 0.5 * (n - 1)) * spacing, y, (j - 0.5 * (n - 1)) * spacing));
+                ball->SetCollide(true);
+
+                ball->GetCollisionModel()->ClearModel();
+                ball->GetCollisionModel()->AddSphere(material, radius);
+                ball->GetCollisionModel()->BuildModel();
+
+                system.AddBody(ball);
+                balls.push_back(ball);
+            }
+        }
+    }
+
+    ground = utils::CreateBoxContainer(&system, 0, material, ChVector<>(4, 4, 2 * radius), 0.1, ChVector<>(0, 0, 0),
+                                       ChQuaternion<>(1, 0, 0, 0), true, true, false, false);
+}
+
+TEST(ChronoParallel, gauss_seidel) {
+    ChSystemParallelNSC system_serial;
+    std::vector<std::shared_ptr<ChBody>> balls_serial;
+    std::shared_ptr<ChBody> ground_serial;
+    CreatePile(system_serial, 1, balls_serial, ground_serial);
+
+    ChSystemParallelNSC system_threads;
+    std::vector<std::shared_ptr<ChBody>> balls_threads;
+    std::shared_ptr<ChBody> ground_threads;
+    CreatePile(system_threads, 4, balls_threads, ground_threads);
+
+    double total_weight = 0;
+    for (auto& ball : balls_serial)
+        total_weight += ball->GetMass() * 9.81;
+
+    while (system_serial.GetChTime() < 1.5) {
+        system_serial.DoStepDynamics(1e-3);
+        system_threads.DoStepDynamics(1e-3);
+    }
+
+    // The pile is at rest on the container in both cases
+    system_threads.GetContactContainer()->ComputeContactForces();
+    ASSERT_LT(std::abs(1 - ground_threads->GetContactForce().y() / total_weight), 1e-2);
+
+    for (size_t i = 0; i < balls_serial.size(); i++) {
+        ASSERT_LT((balls_threads[i]->GetPos() - balls_serial[i]->GetPos()).Length(), 1e-5);
+        ASSERT_LT(balls_threads[i]->GetPos_dt().Length(), 1e-2);
+    }
+}
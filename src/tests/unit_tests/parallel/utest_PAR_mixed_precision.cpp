@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the mixed precision mode of the Chrono::Parallel NSC solver.
+// A pile of balls settles in a container, once with the full precision Shur
+// product and once in mixed precision (with periodic iterative refinement of the
+// solver residual). The contact force on the container must balance the total
+// weight and the final ball positions must agree.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_parallel/physics/ChSystemParallel.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+
+static void CreatePile(ChSystemParallelNSC& system,
+                       SolverType solver_type,
+                       bool mixed,
+                       std::vector<std::shared_ptr<ChBody>>& balls,
+                       std::shared_ptr<ChBody>& ground) {
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.SetNumThreads(1);
+    system.GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    system.GetSettings()->solver.max_iteration_normal = 0;
+    system.GetSettings()->solver.max_iteration_sliding = 100;
+    system.GetSettings()->solver.max_iteration_spinning = 0;
+    system.GetSettings()->solver.tolerance = 1e-5;
+    system.GetSettings()->solver.use_mixed_precision = mixed;
+    system.GetSettings()->solver.mixed_precision_correction = 10;
+    system.ChangeSolverType(solver_type);
+
+    auto material = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    material->SetFriction(0.4f);
+
+    // A 3x3 bottom layer and a 2x2 top layer resting in the pockets of the bottom one
+    double radius = 0.5;
+    double mass = 5;
+    double spacing = 2.1 * radius;
+    for (int layer = 0; layer < 2; layer++) {
+        int n = 3 - layer;
+        double y = (layer == 0) ? 1.02 * radius : 2.6 * radius;
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                auto ball = std::shared_ptr<ChBody>(system.NewBody());
+                ball->SetMass(mass);
+                ball->SetInertiaXX(0.4 * mass * radius * radius * ChVector<>(1, 1, 1));
+                ball->SetPos(ChVector<>((i - 0.5 * (n - 1)) * spacing, y, (j - 0.5 * (n - 1)) * spacing));
+                ball->SetCollide(true);
+
+                ball->GetCollisionModel()->ClearModel();
+                ball->GetCollisionModel()->AddSphere(material, radius);
+                ball->GetCollisionModel()->BuildModel();
+
+                system.AddBody(ball);
+                balls.push_back(ball);
+            }
+        }
+    }
+
+    ground = utils::CreateBoxContainer(&system, 0, material, ChVector<>(4, 4, 2 * radius), 0.1, ChVector<>(0, 0, 0),
+                                       ChQuaternion<>(1, 0, 0, 0), true, true, false, false);
+}
+
+static void ComparePiles(SolverType solver_type) {
+    ChSystemParallelNSC system_ref;
+    std::vector<std::shared_ptr<ChBody>> balls_ref;
+    std::shared_ptr<ChBody> ground_ref;
+    CreatePile(system_ref, solver_type, false, balls_ref, ground_ref);
+
+    ChSystemParallelNSC system_mixed;
+    std::vector<std::shared_ptr<ChBody>> balls_mixed;
+    std::shared_ptr<ChBody> ground_mixed;
+    CreatePile(system_mixed, solver_type, true, balls_mixed, ground_mixed);
+
+    double total_weight = 0;
+    for (auto& ball : balls_ref)
+        total_weight += ball->GetMass() * 9.81;
+
+    while (system_ref.GetChTime() < 1.5) {
+        system_ref.DoStepDynamics(1e-3);
+        system_mixed.DoStepDynamics(1e-3);
+    }
+
+    // The pile is at rest on the container in both cases
+    system_mixed.GetContactContainer()->ComputeContactForces();
+    ASSERT_LT(std::abs(1 - ground_mixed->GetContactForce().y() / total_weight), 1e-2);
+
+    for (size_t i = 0; i < balls_ref.size(); i++) {
+        ASSERT_LT((balls_mixed[i]->GetPos() - balls_ref[i]->GetPos()).Length(), 5e-3);
+        ASSERT_LT(balls_mixed[i]->GetPos_dt().Length(), 1e-2);
+    }
+}
+
+TEST(ChronoParallel, mixed_precision_APGD) {
+    ComparePiles(SolverType::APGD);
+}
+
+// SPGQP updates its gradient recursively and relies on the refinement to bound the rounding error
+TEST(ChronoParallel, mixed_precision_SPGQP) {
+    ComparePiles(SolverType::SPGQP);
+}
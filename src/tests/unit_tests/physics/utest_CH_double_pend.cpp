@@ -27,6 +27,7 @@
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChLinkLock.h"
 #include "chrono/physics/ChLinkMate.h"
+#include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
 #include "chrono/utils/ChUtilsValidation.h"
 
@@ -366,6 +367,161 @@ bool test_HHT(double step, int num_steps, const utils::Data& ref_data, double to
     return check_state && check_cnstr;
 }
 
+template <typename ChronoModelType>
+bool test_HHT_error(double step, int num_steps, const utils::Data& ref_data, double tol_state, double tol_cnstr) {
+    // Create Chrono model.
+    ChronoModelType model;
+    std::shared_ptr<ChSystemNSC> system = model.GetSystem();
+
+    std::cout << "HHT integrator with error control *** " << model.GetJointType() << std::endl;
+
+    // Set integrator and modify parameters.
+    system->SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(system->GetTimestepper());
+    integrator->SetAlpha(0);
+    integrator->SetMaxiters(20);
+    integrator->SetAbsTolerances(1e-6);
+    integrator->SetErrorControl(true, 1e-3, 1e-7);
+
+    // Simulate the model for the specified number of steps.
+    model.Simulate(step, num_steps);
+
+    std::cout << "  accepted steps: " << integrator->GetNumAcceptedSteps()
+              << "  rejected steps: " << integrator->GetNumRejectedSteps()
+              << "  failed steps: " << integrator->GetNumFailedSteps() << std::endl;
+
+    // Validate states (x and y for pendulum body).
+    utils::DataVector norms_state;
+    bool check_state = utils::Validate(model.GetData(), ref_data, utils::RMS_NORM, tol_state, norms_state);
+    std::cout << "  validate states: " << (check_state ? "Passed" : "Failed") << "  (tolerance = " << tol_state
+        << ")" << std::endl;
+    for (size_t col = 0; col < norms_state.size(); col++)
+        std::cout << "    " << norms_state[col] << std::endl;
+
+    // Validate constraint violations.
+    utils::DataVector norms_cnstr;
+    bool check_cnstr = utils::Validate(model.GetCnstrData(), utils::RMS_NORM, tol_cnstr, norms_cnstr);
+    std::cout << "  validate constraints: " << (check_cnstr ? "Passed" : "Failed") << "  (tolerance = " << tol_cnstr
+        << ")" << std::endl;
+    for (size_t col = 0; col < norms_cnstr.size(); col++)
+        std::cout << "    " << norms_cnstr[col] << std::endl;
+
+    return check_state && check_cnstr;
+}
+
+template <typename ChronoModelType>
+bool test_HHT_error_control(double step, int num_steps) {
+    // Create Chrono model.
+    ChronoModelType model;
+    std::shared_ptr<ChSystemNSC> system = model.GetSystem();
+
+    std::cout << "HHT error control behavior *** " << model.GetJointType() << std::endl;
+
+    // Set integrator and modify parameters.
+    system->SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(system->GetTimestepper());
+    integrator->SetAlpha(0);
+    integrator->SetMaxiters(20);
+    integrator->SetAbsTolerances(1e-6);
+    integrator->SetErrorControl(true, 1e-6, 1e-9);
+
+    // With a coarse step and a tight tolerance, the controller must subdivide the requested steps.
+    for (int it = 0; it < num_steps; it++)
+        system->DoStepDynamics(step);
+
+    int num_accepted = integrator->GetNumAcceptedSteps();
+    int num_rejected = integrator->GetNumRejectedSteps();
+    bool check_substeps = num_accepted > num_steps || num_rejected > 0;
+    std::cout << "  accepted steps: " << num_accepted << "  rejected steps: " << num_rejected << "  ("
+              << num_steps << " requested steps) " << (check_substeps ? "Passed" : "Failed") << std::endl;
+
+    // After an event, the first internal step is limited to a fraction of the requested step. With a maximum
+    // increase factor of 1.5, the step size proposed at the end of the requested step remains below 0.9 * step.
+    integrator->SetErrorControl(true, 1e-2, 1e-4);
+    integrator->SetErrorControlFactors(0.9, 1.5);
+    integrator->ResetStepStatistics();
+    integrator->NotifyEvent();
+    system->DoStepDynamics(step);
+
+    bool check_event = integrator->GetNumAcceptedSteps() > 1 && integrator->GetStepSize() < step;
+    std::cout << "  after event: accepted steps: " << integrator->GetNumAcceptedSteps()
+              << "  next stepsize: " << integrator->GetStepSize() << " " << (check_event ? "Passed" : "Failed")
+              << std::endl;
+
+    return check_substeps && check_event;
+}
+
+// Callback accumulating the number of Newton matrix updates over all steps.
+class SetupCounter : public ChSystem::CustomStepCallback {
+  public:
+    SetupCounter(std::shared_ptr<ChImplicitIterativeTimestepper> integrator)
+        : m_integrator(integrator), m_num_setups(0) {}
+    virtual void OnEndStep(ChSystem* system) override { m_num_setups += m_integrator->GetNumSetupCalls(); }
+    int GetNumSetups() const { return m_num_setups; }
+
+  private:
+    std::shared_ptr<ChImplicitIterativeTimestepper> m_integrator;
+    int m_num_setups;
+};
+
+template <typename ChronoModelType>
+bool test_REUSE(ChTimestepper::Type type,
+                double step,
+                int num_steps,
+                const utils::Data& ref_data,
+                double tol_state,
+                double tol_cnstr) {
+    // Create Chrono model.
+    ChronoModelType model;
+    std::shared_ptr<ChSystemNSC> system = model.GetSystem();
+
+    // Use a direct linear solver (factorization retained across steps).
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    system->SetSolver(solver);
+
+    // Set integrator and modify parameters.
+    system->SetTimestepperType(type);
+    if (auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(system->GetTimestepper()))
+        hht->SetAlpha(0);
+    auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(system->GetTimestepper());
+    integrator->SetMaxiters(20);
+    integrator->SetAbsTolerances(1e-6);
+    integrator->SetJacobianReuse(10);
+
+    std::cout << "Integrator type " << static_cast<int>(type) << " with Jacobian reuse *** " << model.GetJointType()
+              << std::endl;
+
+    // Count the Newton matrix updates.
+    auto counter = chrono_types::make_shared<SetupCounter>(integrator);
+    system->RegisterCustomStepCallback(counter);
+
+    // Simulate the model for the specified number of steps.
+    model.Simulate(step, num_steps);
+
+    // Validate states (x and y for pendulum body).
+    utils::DataVector norms_state;
+    bool check_state = utils::Validate(model.GetData(), ref_data, utils::RMS_NORM, tol_state, norms_state);
+    std::cout << "  validate states: " << (check_state ? "Passed" : "Failed") << "  (tolerance = " << tol_state
+        << ")" << std::endl;
+    for (size_t col = 0; col < norms_state.size(); col++)
+        std::cout << "    " << norms_state[col] << std::endl;
+
+    // Validate constraint violations.
+    utils::DataVector norms_cnstr;
+    bool check_cnstr = utils::Validate(model.GetCnstrData(), utils::RMS_NORM, tol_cnstr, norms_cnstr);
+    std::cout << "  validate constraints: " << (check_cnstr ? "Passed" : "Failed") << "  (tolerance = " << tol_cnstr
+        << ")" << std::endl;
+    for (size_t col = 0; col < norms_cnstr.size(); col++)
+        std::cout << "    " << norms_cnstr[col] << std::endl;
+
+    // Check that the Newton matrix was reused across steps.
+    bool check_reuse = counter->GetNumSetups() < num_steps / 4;
+    std::cout << "  matrix updates: " << counter->GetNumSetups() << "  (" << num_steps << " steps) "
+              << (check_reuse ? "Passed" : "Failed") << std::endl;
+
+    return check_state && check_cnstr && check_reuse;
+}
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
@@ -391,6 +547,13 @@ int main(int argc, char* argv[]) {
     passed &= test_EULER<ChronoModelM>(step, num_steps, ref_data, tol_state, tol_cnstr);
     passed &= test_HHT<ChronoModelL>(step, num_steps, ref_data, tol_state, tol_cnstr);
     passed &= test_HHT<ChronoModelM>(step, num_steps, ref_data, tol_state, tol_cnstr);
+    passed &= test_HHT_error<ChronoModelL>(step, num_steps, ref_data, tol_state, tol_cnstr);
+    passed &= test_HHT_error_control<ChronoModelL>(1e-2, 20);
+    passed &= test_REUSE<ChronoModelL>(ChTimestepper::Type::HHT, step, num_steps, ref_data, tol_state, tol_cnstr);
+    passed &= test_REUSE<ChronoModelL>(ChTimestepper::Type::EULER_IMPLICIT, step, num_steps, ref_data, tol_state,
+                                       tol_cnstr);
+    passed &= test_REUSE<ChronoModelL>(ChTimestepper::Type::TRAPEZOIDAL, step, num_steps, ref_data, tol_state,
+                                       tol_cnstr);
 
     // Return 0 if all tests passed.
     return !passed;
@@ -0,0 +1,198 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the binary trajectory writer and memory-mapped reader.
+// A set of falling bodies is recorded through an end-of-step callback and the
+// data read back is compared against the values collected during simulation.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/utils/ChUtilsTrajectory.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+static void TestVector(const ChVector<>& v1, const ChVector<>& v2) {
+    ASSERT_DOUBLE_EQ(v1.x(), v2.x());
+    ASSERT_DOUBLE_EQ(v1.y(), v2.y());
+    ASSERT_DOUBLE_EQ(v1.z(), v2.z());
+}
+
+TEST(ChTrajectory, WriteRead) {
+    const std::string filename = "utest_CH_trajectory.dat";
+    const int num_bodies = 5;
+    const int num_steps = 23;
+    const double step = 1e-2;
+
+    ChSystemNSC system;
+    for (int i = 0; i < num_bodies; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetIdentifier(100 + i);
+        body->SetPos(ChVector<>(i, 0, 0));
+        body->SetWvel_par(ChVector<>(0, 0, 0.1 * i));
+        system.AddBody(body);
+    }
+
+    // Record every other step, with small chunks to exercise the chunk index
+    std::vector<double> times;
+    std::vector<ChVector<>> pos;
+    std::vector<ChVector<>> vel;
+    {
+        auto writer = chrono_types::make_shared<ChTrajectoryWriter>(filename, TRAJ_ALL, 4);
+        writer->SetOutputInterval(2);
+        system.RegisterCustomStepCallback(writer);
+
+        for (int n = 0; n < num_steps; n++) {
+            system.DoStepDynamics(step);
+            if (n % 2 == 0) {
+                times.push_back(system.GetChTime());
+                for (auto& body : system.Get_bodylist()) {
+                    pos.push_back(body->GetPos());
+                    vel.push_back(body->GetPos_dt());
+                }
+            }
+        }
+
+        ASSERT_EQ(writer->GetNumFrames(), times.size());
+        writer->Close();
+    }
+
+    ChTrajectoryReader reader(filename);
+    ASSERT_EQ(reader.GetNumFrames(), times.size());
+    ASSERT_EQ(reader.GetNumBodies(), num_bodies);
+    ASSERT_TRUE(reader.HasField(TRAJ_CONTACT_TORQUE));
+    ASSERT_EQ(reader.FindBody(102), 2);
+    ASSERT_EQ(reader.FindBody(7), -1);
+
+    for (size_t f = 0; f < times.size(); f++) {
+        ASSERT_DOUBLE_EQ(reader.GetTime(f), times[f]);
+        ASSERT_EQ(reader.FindFrame(times[f] + 1e-4), f);
+        for (size_t b = 0; b < num_bodies; b++) {
+            TestVector(reader.GetPos(f, b), pos[f * num_bodies + b]);
+            TestVector(reader.GetLinVel(f, b), vel[f * num_bodies + b]);
+            ASSERT_NEAR(reader.GetAngVel(f, b).z(), 0.1 * b, 1e-12);
+            ASSERT_NEAR(reader.GetRot(f, b).Length(), 1.0, 1e-12);
+        }
+    }
+
+    // Out-of-range indices are rejected
+    ASSERT_THROW(reader.GetPos(0, num_bodies), ChException);
+    ASSERT_THROW(reader.GetRot(0, num_bodies), ChException);
+    ASSERT_THROW(reader.GetPos(times.size(), 0), ChException);
+
+    // Zero-copy access to a full frame column
+    const double* data = reader.GetFrameData(TRAJ_POS, times.size() - 1);
+    ASSERT_DOUBLE_EQ(data[3 * 4 + 0], 4.0);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ChTrajectory, SelectedFields) {
+    const std::string filename = "utest_CH_trajectory_sel.dat";
+
+    ChSystemNSC system;
+    auto body = chrono_types::make_shared<ChBody>();
+    system.AddBody(body);
+
+    {
+        ChTrajectoryWriter writer(filename, TRAJ_POS | TRAJ_ANG_VEL);
+        for (int n = 0; n < 10; n++) {
+            system.DoStepDynamics(1e-3);
+            writer.WriteFrame(&system);
+        }
+    }
+
+    ChTrajectoryReader reader(filename);
+    ASSERT_EQ(reader.GetNumFrames(), 10);
+    ASSERT_FALSE(reader.HasField(TRAJ_ROT));
+    ASSERT_EQ(reader.GetFrameData(TRAJ_ROT, 0), nullptr);
+    TestVector(reader.GetPos(9, 0), body->GetPos());
+    ASSERT_LT(reader.GetPos(9, 0).y(), 0.0);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ChTrajectory, ContactForces) {
+    const std::string filename = "utest_CH_trajectory_contact.dat";
+    const double mass = 8.0;
+
+    ChSystemNSC system;
+    auto material = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 1, 4, 1000, false, true, material);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.2, 0.2, mass / 0.008, false, true, material);
+    box->SetPos(ChVector<>(0, 0.1, 0));
+    system.AddBody(box);
+
+    std::vector<ChVector<>> force;
+    std::vector<ChVector<>> torque;
+    {
+        ChTrajectoryWriter writer(filename, TRAJ_CONTACT_FORCE | TRAJ_CONTACT_TORQUE);
+        for (int n = 0; n < 200; n++) {
+            system.DoStepDynamics(1e-3);
+            writer.WriteFrame(&system);
+            force.push_back(box->GetContactForce());
+            torque.push_back(box->GetContactTorque());
+        }
+    }
+
+    ChTrajectoryReader reader(filename);
+    ASSERT_FALSE(reader.HasField(TRAJ_POS));
+    for (size_t f = 0; f < force.size(); f++) {
+        TestVector(reader.GetContactForce(f, 1), force[f]);
+        TestVector(reader.GetContactTorque(f, 1), torque[f]);
+    }
+
+    // The box rests on the ground: the recorded contact force balances its weight
+    double weight = mass * system.Get_G_acc().Length();
+    ASSERT_NEAR(reader.GetContactForce(force.size() - 1, 1).y(), weight, 0.05 * weight);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ChTrajectory, CorruptFile) {
+    const std::string filename = "utest_CH_trajectory_bad.dat";
+
+    ChSystemNSC system;
+    system.AddBody(chrono_types::make_shared<ChBody>());
+    {
+        ChTrajectoryWriter writer(filename, TRAJ_POS, 2);
+        for (int n = 0; n < 5; n++) {
+            system.DoStepDynamics(1e-3);
+            writer.WriteFrame(&system);
+        }
+    }
+
+    // Overwrite the chunk index offset in the trailer with an out-of-range value
+    std::fstream file(filename, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(-16, std::ios::end);
+    uint64_t bad_offset = 1ull << 40;
+    file.write(reinterpret_cast<const char*>(&bad_offset), sizeof(bad_offset));
+    file.close();
+
+    ASSERT_THROW(ChTrajectoryReader reader(filename), ChException);
+
+    std::remove(filename.c_str());
+}
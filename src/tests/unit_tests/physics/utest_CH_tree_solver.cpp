@@ -0,0 +1,121 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the linear-time direct solver for tree-structured mechanisms.
+// A chain of pendulums is simulated with the HHT integrator using ChSolverTreeLU
+// and ChSolverSparseLU; the two trajectories must coincide. Closing the chain
+// into a loop must trigger the fallback to SparseLU.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+using namespace chrono;
+
+// Joint locations along a zigzag chain (no three consecutive joints aligned).
+static ChVector<> JointLocation(int i) {
+    return ChVector<>(i, 0.5 * (i % 2), 0);
+}
+
+// Create a chain of bodies hanging from the ground, connected by revolute joints.
+// If 'loop' is true, spherical joints are used and the last body is also connected to the ground.
+static std::vector<std::shared_ptr<ChBody>> CreateChain(ChSystemNSC& system, int num_bodies, bool loop) {
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    auto prev = ground;
+    for (int i = 0; i < num_bodies; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetPos(0.5 * (JointLocation(i) + JointLocation(i + 1)));
+        body->SetMass(1 + 0.1 * i);
+        body->SetInertiaXX(ChVector<>(0.1, 0.1, 0.1));
+        system.AddBody(body);
+
+        std::shared_ptr<ChLinkLock> joint;
+        if (loop)
+            joint = chrono_types::make_shared<ChLinkLockSpherical>();
+        else
+            joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(prev, body, ChCoordsys<>(JointLocation(i)));
+        system.AddLink(joint);
+
+        bodies.push_back(body);
+        prev = body;
+    }
+
+    if (loop) {
+        auto joint = chrono_types::make_shared<ChLinkLockSpherical>();
+        joint->Initialize(prev, ground, ChCoordsys<>(JointLocation(num_bodies)));
+        system.AddLink(joint);
+    }
+
+    return bodies;
+}
+
+static void SetIntegrator(ChSystemNSC& system, std::shared_ptr<ChDirectSolverLS> solver) {
+    system.SetSolver(solver);
+    system.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(system.GetTimestepper());
+    integrator->SetAlpha(-0.2);
+    integrator->SetMaxiters(20);
+    integrator->SetAbsTolerances(1e-8);
+}
+
+// Simulate the chain with ChSolverTreeLU and ChSolverSparseLU and compare the trajectories.
+static std::shared_ptr<ChSolverTreeLU> CompareSolvers(int num_bodies, bool loop, int num_steps) {
+    ChSystemNSC system_tree;
+    auto bodies_tree = CreateChain(system_tree, num_bodies, loop);
+    auto solver_tree = chrono_types::make_shared<ChSolverTreeLU>();
+    SetIntegrator(system_tree, solver_tree);
+
+    ChSystemNSC system_ref;
+    auto bodies_ref = CreateChain(system_ref, num_bodies, loop);
+    SetIntegrator(system_ref, chrono_types::make_shared<ChSolverSparseLU>());
+
+    for (int n = 0; n < num_steps; n++) {
+        system_tree.DoStepDynamics(1e-3);
+        system_ref.DoStepDynamics(1e-3);
+    }
+
+    for (int i = 0; i < num_bodies; i++) {
+        EXPECT_NEAR((bodies_tree[i]->GetPos() - bodies_ref[i]->GetPos()).Length(), 0.0, 1e-8);
+        EXPECT_NEAR((bodies_tree[i]->GetPos_dt() - bodies_ref[i]->GetPos_dt()).Length(), 0.0, 1e-6);
+    }
+
+    // The chain has moved under gravity
+    EXPECT_LT(bodies_tree[num_bodies / 2]->GetPos().y(), 0.5 * (JointLocation(num_bodies / 2).y() +
+                                                                JointLocation(num_bodies / 2 + 1).y()) - 1e-4);
+
+    return solver_tree;
+}
+
+TEST(ChSolverTreeLU, Chain) {
+    const int num_bodies = 20;
+    auto solver = CompareSolvers(num_bodies, false, 100);
+
+    // One block per body and one per joint
+    ASSERT_TRUE(solver->IsTreeStructured());
+    ASSERT_EQ(solver->GetNumBlocks(), 2 * num_bodies);
+}
+
+TEST(ChSolverTreeLU, Loop) {
+    // The closed chain is not a tree: the solver falls back to SparseLU
+    auto solver = CompareSolvers(5, true, 100);
+    ASSERT_FALSE(solver->IsTreeStructured());
+}
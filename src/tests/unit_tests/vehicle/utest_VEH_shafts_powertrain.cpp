@@ -0,0 +1,84 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the subcycled shafts powertrain.
+// An HMMWV on a fixed chassis (no tires) is driven with constant throttle, once
+// with the powertrain shafts integrated in the vehicle system and once subcycled
+// in a separate system. The driveshaft torque and the powertrain reaction torque
+// on the chassis, averaged over the last part of the simulation (after the first
+// upshift), are compared.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono_vehicle/ChDriver.h"
+#include "chrono_vehicle/terrain/FlatTerrain.h"
+
+#include "chrono_models/vehicle/hmmwv/HMMWV_VehicleReduced.h"
+#include "chrono_models/vehicle/hmmwv/HMMWV_Powertrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+struct Torques {
+    double driveshaft;
+    ChVector<> chassis;
+};
+
+static Torques Simulate(double subcycle_step) {
+    const double step = 1e-3;
+    const double t_end = 1.5;
+    const double t_avg = 1.0;
+
+    HMMWV_VehicleReduced vehicle(true, DrivelineType::AWD, BrakeType::SIMPLE, ChContactMethod::NSC,
+                                 ChassisCollisionType::NONE);
+    vehicle.Initialize(ChCoordsys<>(ChVector<>(0, 0, 1), QUNIT));
+
+    auto powertrain = chrono_types::make_shared<HMMWV_Powertrain>("Powertrain");
+    powertrain->SetSubcycling(subcycle_step);
+    vehicle.InitializePowertrain(powertrain);
+    EXPECT_EQ(powertrain->IsSubcycled(), subcycle_step > 0);
+
+    FlatTerrain terrain(0);
+    ChDriver::Inputs inputs = {0.0, 0.5, 0.0};
+
+    Torques avg = {0, ChVector<>(0)};
+    int num_samples = 0;
+    while (vehicle.GetChTime() < t_end - step / 2) {
+        double time = vehicle.GetChTime();
+        vehicle.Synchronize(time, inputs, terrain);
+        vehicle.Advance(step);
+        if (time >= t_avg) {
+            avg.driveshaft += powertrain->GetDriveshaftTorque();
+            avg.chassis += powertrain->GetChassisReactionTorque();
+            num_samples++;
+        }
+    }
+    avg.driveshaft /= num_samples;
+    avg.chassis /= num_samples;
+
+    return avg;
+}
+
+TEST(ChShaftsPowertrain, subcycling) {
+    Torques monolithic = Simulate(0);
+    Torques subcycled = Simulate(2.5e-4);
+
+    // The engine accelerates the driveline and loads the chassis
+    ASSERT_GT(monolithic.driveshaft, 0);
+    ASSERT_GT(monolithic.chassis.Length(), 0);
+
+    ASSERT_NEAR(subcycled.driveshaft, monolithic.driveshaft, 0.02 * std::abs(monolithic.driveshaft));
+    ASSERT_NEAR((subcycled.chassis - monolithic.chassis).Length(), 0.0, 0.02 * monolithic.chassis.Length());
+}